@@ -0,0 +1,94 @@
+// Measures the per-frame round trip of SharedMemoryTransport against a stand-in server process.
+// The server forks off, readies a frame, and waits for the client to hand it back; the client
+// times each hand-off from its signal until the next frame is ready.
+//
+// Linux only; build with
+//   make -C BWAPIClient/Benchmark
+//
+// Usage: HandshakeLatency [frames]
+#include <BWAPI/Client/Transport.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace BWAPI;
+
+namespace
+{
+  // Plays the server's half: each frame, bump the frame count and hand the data to the client.
+  int runServer(int frames)
+  {
+    SharedMemoryTransport server(getpid(), SharedMemoryTransport::ServerRole);
+    if ( !server.open() )
+      return 1;
+    for ( int frame = 0; frame <= frames; ++frame )
+    {
+      server.getData()->frameCount = frame;
+      server.signal();
+      if ( !server.wait() )
+        return 1;
+    }
+    server.close();
+    return 0;
+  }
+}
+
+int main(int argc, const char *argv[])
+{
+  int frames = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+  pid_t serverProcID = fork();
+  if ( serverProcID == 0 )
+    return runServer(frames);
+
+  // the server creates the shared memory object, so retry until it's there
+  SharedMemoryTransport client(serverProcID);
+  bool opened = false;
+  for ( int attempt = 0; attempt < 1000 && !opened; ++attempt )
+  {
+    opened = client.open();
+    if ( !opened )
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  if ( !opened || !client.wait() )
+  {
+    std::fprintf(stderr, "Unable to reach the stand-in server\n");
+    return 1;
+  }
+
+  std::vector<double> roundTrips;
+  roundTrips.reserve(frames);
+  int mismatches = 0;
+  auto start = std::chrono::steady_clock::now();
+  for ( int frame = 1; frame <= frames; ++frame )
+  {
+    auto sent = std::chrono::steady_clock::now();
+    client.signal();
+    if ( !client.wait() )
+    {
+      std::fprintf(stderr, "Server went away after %d frames\n", frame - 1);
+      return 1;
+    }
+    roundTrips.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - sent).count());
+    if ( client.getData()->frameCount != frame )
+      ++mismatches;
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  client.signal();
+  client.close();
+  waitpid(serverProcID, nullptr, 0);
+
+  std::sort(roundTrips.begin(), roundTrips.end());
+  std::printf("%d frames, %.0f frames/s, %d out of order\n", frames, frames / seconds, mismatches);
+  std::printf("round trip us: min %.2f  median %.2f  p99 %.2f  max %.2f\n",
+              roundTrips.front(), roundTrips[roundTrips.size() / 2],
+              roundTrips[roundTrips.size() * 99 / 100], roundTrips.back());
+  return 0;
+}
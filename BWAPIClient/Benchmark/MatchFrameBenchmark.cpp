@@ -0,0 +1,170 @@
+// Times GameImpl::onMatchFrame against a game snapshot, without a running game.
+//
+// Build with the MatchFrameBenchmark project in TerranProject.sln, or on Linux with
+//   make -C BWAPIClient/Benchmark
+//
+// Usage: MatchFrameBenchmark [snapshot.bin] [frames]
+//        MatchFrameBenchmark --write snapshot.bin
+// A snapshot is a raw copy of the shared GameData block, about 33 MB, recorded from a
+// connected client on a frame of interest with
+//   fwrite(BWAPI::BWAPIClient.data, sizeof(BWAPI::GameData), 1, file);
+// Snapshots are too large to keep in the repository. Without one, a synthetic snapshot with
+// 200 units per side is generated: marines, dropships carrying them, hatcheries with larvae
+// and carriers with interceptors, plus a few bullets. Each frame, a few marines board or leave
+// their dropships and a few bullets appear or vanish. A recorded snapshot is replayed as it
+// stands. --write saves the synthetic snapshot, so the loading path can be checked as well.
+#include <BWAPI.h>
+#include <BWAPI/Client.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+using namespace BWAPI;
+
+namespace
+{
+  const int UNITS_PER_SIDE = 200;
+
+  void addUnit(GameData *data, int id, int player, UnitType type)
+  {
+    UnitData &u = data->units[id];
+    u.exists    = true;
+    u.player    = player;
+    u.type      = type;
+    u.transport = -1;
+    u.carrier   = -1;
+    u.hatchery  = -1;
+    u.positionX = 64 + (id % 64) * 32;
+    u.positionY = 64 + (id / 64) * 32;
+    data->initialUnitCount = std::max(data->initialUnitCount, id + 1);
+  }
+
+  void makeSyntheticSnapshot(GameData *data)
+  {
+    data->playerCount = 3;
+    for ( int p = 0; p < 3; ++p )
+    {
+      PlayerData &pd = data->players[p];
+      pd.isParticipating = p < 2;
+      pd.isNeutral       = p == 2;
+      for ( int q = 0; q < 3; ++q )
+      {
+        pd.isAlly[q]  = p == q;
+        pd.isEnemy[q] = p != q && p < 2 && q < 2;
+      }
+    }
+    data->self    = 0;
+    data->enemy   = 1;
+    data->neutral = 2;
+
+    // terran side: 160 marines, 40 dropships carrying one marine each
+    int id = 0;
+    for ( int i = 0; i < 40; ++i )
+    {
+      int dropship = id++;
+      addUnit(data, dropship, 0, UnitTypes::Terran_Dropship);
+      for ( int m = 0; m < 4; ++m )
+      {
+        int marine = id++;
+        addUnit(data, marine, 0, UnitTypes::Terran_Marine);
+        if ( m == 0 )
+          data->units[marine].transport = dropship;
+      }
+    }
+    // other side: 20 hatcheries with 3 larvae each, 20 carriers with 4 interceptors each, 40 zerglings
+    for ( int i = 0; i < 20; ++i )
+    {
+      int hatchery = id++;
+      addUnit(data, hatchery, 1, UnitTypes::Zerg_Hatchery);
+      for ( int l = 0; l < 3; ++l )
+      {
+        addUnit(data, id, 1, UnitTypes::Zerg_Larva);
+        data->units[id++].hatchery = hatchery;
+      }
+      int carrier = id++;
+      addUnit(data, carrier, 1, UnitTypes::Protoss_Carrier);
+      for ( int c = 0; c < 4; ++c )
+      {
+        addUnit(data, id, 1, UnitTypes::Protoss_Interceptor);
+        data->units[id++].carrier = carrier;
+      }
+    }
+    while ( id < 2 * UNITS_PER_SIDE )
+      addUnit(data, id++, 1, UnitTypes::Zerg_Zergling);
+
+    for ( int b = 0; b < 30; ++b )
+      data->bullets[b].exists = true;
+  }
+
+  // Moves a few marines in and out of dropships and a few bullets in and out of existence,
+  // roughly what a busy frame changes.
+  void churn(GameData *data, int frame)
+  {
+    for ( int i = 0; i < 4; ++i )
+    {
+      int dropship = ((frame * 4 + i) % 40) * 5;
+      UnitData &marine = data->units[dropship + 2];
+      marine.transport = marine.transport == -1 ? dropship : -1;
+    }
+    data->bullets[30 + frame % 10].exists = !data->bullets[30 + frame % 10].exists;
+    data->frameCount = frame;
+  }
+}
+
+int main(int argc, const char *argv[])
+{
+  int frames = argc > 2 ? std::atoi(argv[2]) : 10000;
+
+  // the game data block is far too large for the stack
+  std::unique_ptr<GameData> data(new GameData());
+  std::memset(data.get(), 0, sizeof(GameData));
+  if ( argc > 2 && std::strcmp(argv[1], "--write") == 0 )
+  {
+    makeSyntheticSnapshot(data.get());
+    FILE *f = std::fopen(argv[2], "wb");
+    if ( !f || std::fwrite(data.get(), sizeof(GameData), 1, f) != 1 )
+    {
+      std::fprintf(stderr, "Unable to write snapshot %s\n", argv[2]);
+      return 1;
+    }
+    std::fclose(f);
+    return 0;
+  }
+  if ( argc > 1 )
+  {
+    FILE *f = std::fopen(argv[1], "rb");
+    if ( !f || std::fread(data.get(), sizeof(GameData), 1, f) != 1 )
+    {
+      std::fprintf(stderr, "Unable to read snapshot %s\n", argv[1]);
+      return 1;
+    }
+    std::fclose(f);
+    data->eventCount = 0;
+  }
+  else
+  {
+    makeSyntheticSnapshot(data.get());
+  }
+
+  // the unit, player and bullet objects bind to the client's data block when constructed
+  BWAPIClient.data = data.get();
+  std::unique_ptr<GameImpl> game(new GameImpl(data.get()));
+  BroodwarPtr = game.get();
+  game->onMatchStart();
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for ( int frame = 1; frame <= frames; ++frame )
+  {
+    if ( argc <= 1 )
+      churn(data.get(), frame);
+    game->onMatchFrame();
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+
+  std::printf("%d units, %d frames: %.0f ns per onMatchFrame\n",
+              (int)game->getAllUnits().size(), frames, (double)elapsed.count() / frames);
+  return 0;
+}
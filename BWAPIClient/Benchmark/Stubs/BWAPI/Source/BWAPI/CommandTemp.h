@@ -0,0 +1,18 @@
+#pragma once
+// Stand-in for the BWAPI server's CommandTemp.h, which the client's Command.h includes from the
+// full BWAPI tree. The real one applies an order to the client's copy of the game straight away;
+// the benchmarks never issue orders, so this one does nothing.
+#include <BWAPI/UnitCommand.h>
+
+namespace BWAPI
+{
+  template <class UnitImpl, class PlayerImpl>
+  class CommandTemp
+  {
+    public:
+      CommandTemp(UnitCommand command) : command(command) {}
+      void execute(int frame) {}
+    protected:
+      UnitCommand command;
+  };
+}
@@ -1,6 +1,4 @@
 #include <BWAPI/Client/Client.h>
-#include <windows.h>
-#include <sstream>
 #include <iostream>
 #include <cassert>
 #include <thread>
@@ -10,9 +8,11 @@ namespace BWAPI
 {
   Client BWAPIClient;
   Client::Client()
-    : pipeObjectHandle(INVALID_HANDLE_VALUE)
-    , mapFileHandle(INVALID_HANDLE_VALUE)
-    , gameTableFileHandle(INVALID_HANDLE_VALUE)
+#ifdef _WIN32
+    : transport(new PipeTransport())
+#elif defined(__linux__)
+    : transport(new SharedMemoryTransport())
+#endif
   {}
   Client::~Client()
   {
@@ -22,6 +22,12 @@ namespace BWAPI
   {
     return this->connected;
   }
+  void Client::setTransport(Transport* transport)
+  {
+    if ( this->connected || !transport )
+      return;
+    this->transport.reset(transport);
+  }
   bool Client::connect()
   {
     if ( this->connected )
@@ -30,86 +36,9 @@ namespace BWAPI
       return true;
     }
 
-    int serverProcID    = -1;
-    int gameTableIndex  = -1;
-
-    this->gameTable = NULL;
-    this->gameTableFileHandle = OpenFileMappingA(FILE_MAP_WRITE | FILE_MAP_READ, FALSE, "Local\\bwapi_shared_memory_game_list" );
-    if ( !this->gameTableFileHandle )
-    {
-      std::cerr << "Game table mapping not found." << std::endl;
-      return false;
-    }
-    this->gameTable = static_cast<GameTable*>( MapViewOfFile(this->gameTableFileHandle, FILE_MAP_WRITE | FILE_MAP_READ, 0, 0, sizeof(GameTable)) );
-    if ( !this->gameTable )
-    {
-      std::cerr << "Unable to map Game table." << std::endl;
-      return false;
-    }
-
-    //Find row with most recent keep alive that isn't connected
-    DWORD latest = 0;
-    for(int i = 0; i < GameTable::MAX_GAME_INSTANCES; i++)
-    {
-      std::cout << i << " | " << gameTable->gameInstances[i].serverProcessID << " | " << gameTable->gameInstances[i].isConnected << " | " << gameTable->gameInstances[i].lastKeepAliveTime << std::endl;
-      if (gameTable->gameInstances[i].serverProcessID != 0 && !gameTable->gameInstances[i].isConnected)
-      {
-        if ( gameTableIndex == -1 || latest == 0 || gameTable->gameInstances[i].lastKeepAliveTime < latest )
-        {
-          latest = gameTable->gameInstances[i].lastKeepAliveTime;
-          gameTableIndex = i;
-        }
-      }
-    }
-
-    if (gameTableIndex != -1)
-      serverProcID = gameTable->gameInstances[gameTableIndex].serverProcessID;
-
-    if (serverProcID == -1)
-    {
-      std::cerr << "No server proc ID" << std::endl;
+    if ( !transport || !transport->open() )
       return false;
-    }
-    
-    std::stringstream sharedMemoryName;
-    sharedMemoryName << "Local\\bwapi_shared_memory_";
-    sharedMemoryName << serverProcID;
-
-    std::stringstream communicationPipe;
-    communicationPipe << "\\\\.\\pipe\\bwapi_pipe_";
-    communicationPipe << serverProcID;
-
-    pipeObjectHandle = CreateFileA(communicationPipe.str().c_str(), GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL);
-    if ( pipeObjectHandle == INVALID_HANDLE_VALUE )
-    {
-      std::cerr << "Unable to open communications pipe: " << communicationPipe.str() << std::endl;
-      CloseHandle(gameTableFileHandle);
-      return false;
-    }
-
-    COMMTIMEOUTS c;
-    c.ReadIntervalTimeout         = 100;
-    c.ReadTotalTimeoutMultiplier  = 100;
-    c.ReadTotalTimeoutConstant    = 2000;
-    c.WriteTotalTimeoutMultiplier = 100;
-    c.WriteTotalTimeoutConstant   = 2000;
-    SetCommTimeouts(pipeObjectHandle,&c);
-
-    std::cout << "Connected" << std::endl;
-    mapFileHandle = OpenFileMappingA(FILE_MAP_WRITE | FILE_MAP_READ, FALSE, sharedMemoryName.str().c_str());
-    if (mapFileHandle == INVALID_HANDLE_VALUE || mapFileHandle == NULL)
-    {
-      std::cerr << "Unable to open shared memory mapping: " << sharedMemoryName.str() << std::endl;
-      CloseHandle(pipeObjectHandle);
-      CloseHandle(gameTableFileHandle);
-      return false;
-    }
-    data = static_cast<GameData*>( MapViewOfFile(mapFileHandle, FILE_MAP_WRITE | FILE_MAP_READ, 0, 0, sizeof(GameData)) );
-    if ( data == nullptr )
-    {
-      std::cerr << "Unable to map game data." << std::endl;
-      return false;
-    }
+    data = transport->getData();
 
     // Create new instance of Game/Broodwar
     if ( BWAPI::BroodwarPtr )
@@ -128,17 +57,11 @@ namespace BWAPI
       return false;
     }
     //wait for permission from server before we resume execution
-    int code = 1;
-    while ( code != 2 )
+    if ( !transport->wait() )
     {
-      DWORD receivedByteCount;
-      BOOL success = ReadFile(pipeObjectHandle, &code, sizeof(code), &receivedByteCount, NULL);
-      if ( !success )
-      {
-        disconnect();
-        std::cerr << "Unable to read pipe object." << std::endl;
-        return false;
-      }
+      disconnect();
+      std::cerr << "Unable to read pipe object." << std::endl;
+      return false;
     }
     
     std::cout << "Connection successful" << std::endl;
@@ -151,17 +74,7 @@ namespace BWAPI
   {
     if ( !this->connected ) return;
     
-    if ( gameTableFileHandle != INVALID_HANDLE_VALUE )
-      CloseHandle(gameTableFileHandle);
-    gameTableFileHandle = INVALID_HANDLE_VALUE;
-
-    if ( pipeObjectHandle != INVALID_HANDLE_VALUE )
-      CloseHandle(pipeObjectHandle);
-    pipeObjectHandle = INVALID_HANDLE_VALUE;
-    
-    if ( mapFileHandle != INVALID_HANDLE_VALUE )
-      CloseHandle(mapFileHandle);
-    mapFileHandle = INVALID_HANDLE_VALUE;
+    transport->close();
 
     this->connected = false;
     std::cout << "Disconnected" << std::endl;
@@ -172,22 +85,14 @@ namespace BWAPI
   }
   void Client::update()
   {
-    DWORD writtenByteCount;
-    int code = 1;
-    WriteFile(pipeObjectHandle, &code, sizeof(code), &writtenByteCount, NULL);
+    transport->signal();
     //std::cout << "wrote to pipe" << std::endl;
 
-    while (code != 2)
+    if ( !transport->wait() )
     {
-      DWORD receivedByteCount;
-      //std::cout << "reading pipe" << std::endl;
-      BOOL success = ReadFile(pipeObjectHandle, &code, sizeof(code), &receivedByteCount, NULL);
-      if ( !success )
-      {
-        std::cout << "failed, disconnecting" << std::endl;
-        disconnect();
-        return;
-      }
+      std::cout << "failed, disconnecting" << std::endl;
+      disconnect();
+      return;
     }
     //std::cout << "about to enter event loop" << std::endl;
 
@@ -11,7 +11,9 @@
 #include "Convenience.h"
 #include <string>
 #include <cassert>
+#include <cstring>
 #include <fstream>
+#include <algorithm>
 
 #include <BWAPI/Unitset.h>
 
@@ -19,35 +21,112 @@ namespace BWAPI
 {
   GameImpl::GameImpl(GameData* _data)
     : data(_data)
+    , unitTable(sizeof(_data->units) / sizeof(_data->units[0]), nullptr)
   {
     this->clearAll();
     for(int i = 0; i < 5; ++i)
       forceVector.push_back(ForceImpl(i));
     for(int i = 0; i < 12; ++i)
       playerVector.push_back(PlayerImpl(i));
-    // @TODO: Possible to exceed 10000 here
-    for(int i = 0; i < 10000; ++i)
-      unitVector.push_back(UnitImpl(i));
     for(int i = 0; i < 100; ++i)
       bulletVector.push_back(BulletImpl(i));
     
     inGame = false;
   }
+  namespace
+  {
+    // Drawing is best-effort, so it never gets the last of either buffer: screen overlays stop
+    // short of the strings kept for commands, and map overlays stop short of the screen ones.
+    const int COMMAND_STRING_RESERVE = 256;
+    const int MAP_SHAPE_HEADROOM     = GameData::MAX_SHAPES / 10;
+    const int MAP_STRING_HEADROOM    = GameData::MAX_STRINGS / 10 + COMMAND_STRING_RESERVE;
+
+    // Size of the game view; map shapes entirely outside it are never sent
+    const int SCREEN_WIDTH  = 640;
+    const int SCREEN_HEIGHT = 480;
+    // Text has no known extent, so assume a generous one when culling
+    const int TEXT_CULL_WIDTH  = 640;
+    const int TEXT_CULL_HEIGHT = 128;
+
+    // Longest text a string slot holds
+    const size_t STRING_SLOT_LENGTH = sizeof(static_cast<GameData*>(nullptr)->strings[0]) - 1;
+
+    unsigned hashString(const char* text)
+    {
+      // FNV-1a over the part of the text that fits in a string slot
+      unsigned hash = 2166136261u;
+      for ( size_t i = 0; text[i] && i < STRING_SLOT_LENGTH; ++i )
+        hash = (hash ^ static_cast<unsigned char>(text[i])) * 16777619u;
+      return hash;
+    }
+  }
+  bool GameImpl::hasShapeRoom(const BWAPIC::Shape &s) const
+  {
+    if ( s.ctype != CoordinateType::Map )
+      return data->shapeCount < GameData::MAX_SHAPES;
+    if ( data->shapeCount >= GameData::MAX_SHAPES - MAP_SHAPE_HEADROOM )
+      return false;
+
+    // Cull against the shape's bounding box
+    int left = std::min(s.x1, s.x2), right = std::max(s.x1, s.x2);
+    int top = std::min(s.y1, s.y2), bottom = std::max(s.y1, s.y2);
+    switch ( s.type )
+    {
+    case BWAPIC::ShapeType::Text:
+      left = s.x1; right = s.x1 + TEXT_CULL_WIDTH;
+      top = s.y1; bottom = s.y1 + TEXT_CULL_HEIGHT;
+      break;
+    case BWAPIC::ShapeType::Triangle:
+      left = std::min(left, s.extra1); right = std::max(right, s.extra1);
+      top = std::min(top, s.extra2); bottom = std::max(bottom, s.extra2);
+      break;
+    case BWAPIC::ShapeType::Circle:
+      left = s.x1 - s.extra1; right = s.x1 + s.extra1;
+      top = s.y1 - s.extra1; bottom = s.y1 + s.extra1;
+      break;
+    case BWAPIC::ShapeType::Ellipse:
+      left = s.x1 - s.extra1; right = s.x1 + s.extra1;
+      top = s.y1 - s.extra2; bottom = s.y1 + s.extra2;
+      break;
+    case BWAPIC::ShapeType::Dot:
+      left = right = s.x1;
+      top = bottom = s.y1;
+      break;
+    default:
+      break;
+    }
+    return right >= data->screenX && left < data->screenX + SCREEN_WIDTH &&
+           bottom >= data->screenY && top < data->screenY + SCREEN_HEIGHT;
+  }
   int GameImpl::addShape(const BWAPIC::Shape &s)
   {
-    assert(data->shapeCount < GameData::MAX_SHAPES);
+    if ( !hasShapeRoom(s) )
+      return -1;
     data->shapes[data->shapeCount] = s;
     return data->shapeCount++;
   }
-  int GameImpl::addString(const char* text)
+  int GameImpl::addString(const char* text, int headroom)
   {
-    assert(data->stringCount < GameData::MAX_STRINGS);
+    // Reuse the slot if this text was already sent this frame. The slot's contents are checked
+    // rather than trusted, so slots left over from before the server reset the buffer are safe.
+    int &interned = internedStrings[hashString(text) % internedStrings.size()];
+    if ( interned >= 0 && interned < data->stringCount &&
+         strncmp(data->strings[interned], text, STRING_SLOT_LENGTH) == 0 )
+      return interned;
+
+    if ( data->stringCount >= GameData::MAX_STRINGS - headroom )
+      return -1;
     StrCopy(data->strings[data->stringCount], text);
+    interned = data->stringCount;
     return data->stringCount++;
   }
   int GameImpl::addText(BWAPIC::Shape &s, const char* text)
   {
-    s.extra1 = addString(text);
+    if ( !hasShapeRoom(s) )
+      return -1;
+    s.extra1 = addString(text, s.ctype == CoordinateType::Map ? MAP_STRING_HEADROOM : COMMAND_STRING_RESERVE);
+    if ( s.extra1 < 0 )
+      return -1;
     return addShape(s);
   }
   int GameImpl::addCommand(const BWAPIC::Command &c)
@@ -56,6 +135,15 @@ namespace BWAPI
     data->commands[data->commandCount] = c;
     return data->commandCount++;
   }
+  int GameImpl::addStringCommand(BWAPIC::CommandType::Enum type, const char* text, int value2)
+  {
+    // Commands may use the strings drawing leaves free, but if even those are gone the
+    // command is dropped; the server would otherwise read before the start of the buffer
+    int string = addString(text);
+    if ( string < 0 )
+      return -1;
+    return addCommand(BWAPIC::Command(type, string, value2));
+  }
   int GameImpl::addUnitCommand(BWAPIC::UnitCommand& c)
   {
     assert(data->unitCommandCount < GameData::MAX_UNIT_COMMANDS);
@@ -66,23 +154,32 @@ namespace BWAPI
   {
     return this->getUnit(index);
   }
+  namespace
+  {
+    bool hasText(EventType::Enum type)
+    {
+      return type == EventType::SaveGame || type == EventType::SendText || type == EventType::ReceiveText;
+    }
+  }
   Event GameImpl::makeEvent(BWAPIC::Event e)
   {
     Event e2;
+    fillEvent(e2, e);
+    return e2;
+  }
+  void GameImpl::fillEvent(Event &e2, const BWAPIC::Event &e)
+  {
+    // e2 may be a recycled event, so every field is written
     e2.setType(e.type);
-    if (e.type == EventType::MatchEnd)
-      e2.setWinner(e.v1 != 0);
-    if (e.type == EventType::NukeDetect)
-      e2.setPosition(Position(e.v1,e.v2));
-    if (e.type == EventType::PlayerLeft)
-      e2.setPlayer(getPlayer(e.v1));
+    e2.setWinner(e.type == EventType::MatchEnd && e.v1 != 0);
+    e2.setPosition(e.type == EventType::NukeDetect ? Position(e.v1,e.v2) : Positions::None);
+    e2.setPlayer(e.type == EventType::PlayerLeft || e.type == EventType::ReceiveText ? getPlayer(e.v1) : nullptr);
     if (e.type == EventType::SaveGame || e.type == EventType::SendText)
       e2.setText(data->eventStrings[e.v1]);
-    if (e.type == EventType::ReceiveText)
-    {
-      e2.setPlayer(getPlayer(e.v1));
+    else if (e.type == EventType::ReceiveText)
       e2.setText(data->eventStrings[e.v2]);
-    }
+    else
+      e2.setText(nullptr);
     if (e.type == EventType::UnitDiscover ||
         e.type == EventType::UnitEvade ||
         e.type == EventType::UnitShow ||
@@ -93,8 +190,20 @@ namespace BWAPI
         e.type == EventType::UnitMorph ||
         e.type == EventType::UnitComplete )
       e2.setUnit(getUnit(e.v1));
-    return e2;
-
+    else
+      e2.setUnit(nullptr);
+  }
+  Event& GameImpl::nextEvent(const BWAPIC::Event &e)
+  {
+    // Text events prefer a node whose string can be reused. Other events never take a text
+    // node, since fillEvent would free its string; they allocate once spareEvents runs dry.
+    std::list<Event> *spare = hasText(e.type) && !spareTextEvents.empty() ? &spareTextEvents : &spareEvents;
+    if ( spare->empty() )
+      events.emplace_back();
+    else
+      events.splice(events.end(), *spare, spare->begin());
+    fillEvent(events.back(), e);
+    return events.back();
   }
   void GameImpl::clearAll()
   {
@@ -114,16 +223,28 @@ namespace BWAPI
     selectedUnits.clear();
     pylons.clear();
     events.clear();
+    spareEvents.clear();
+    spareTextEvents.clear();
     thePlayer  = nullptr;
     theEnemy   = nullptr;
     theNeutral = nullptr;
     _allies.clear();
     _enemies.clear();
     _observers.clear();
+    bulletExists.fill(false);
+    lastSelection.clear();
+    playerSetKey = ~0ULL;
+    internedStrings.fill(-1);
 
-    //clear unit data
-    for (auto &v : unitVector)
-      v.clear();
+    //clear unit data; units are reset in place rather than freed, since a bot may still hold
+    //Units from an earlier match, and they're reused when their ids come up again
+    for (auto &u : unitPool)
+    {
+      u.clear();
+      u.loadedUnits.clear();
+      u.connectedToID = -1;
+      u.loadedIntoID  = -1;
+    }
 
     //clear player data
     for (auto &v : playerVector)
@@ -178,10 +299,11 @@ namespace BWAPI
       playerSet.insert(&playerVector[i]);
     for(int i = 0; i < data->initialUnitCount; ++i)
     {
-      if (unitVector[i].exists())
-        accessibleUnits.insert(&unitVector[i]);
+      UnitImpl *u = getUnitImpl(i);
+      if (u->exists())
+        accessibleUnits.insert(u);
       //save the initial state of each initial unit
-      unitVector[i].saveInitialState();
+      u->saveInitialState();
     }
 
     //load start locations from shared memory
@@ -199,29 +321,6 @@ namespace BWAPI
     thePlayer  = getPlayer(data->self);
     theEnemy   = getPlayer(data->enemy);
     theNeutral = getPlayer(data->neutral);
-    _allies.clear();
-    _enemies.clear();
-    _observers.clear();
-    // check if the current player exists
-    if ( thePlayer )
-    {
-      // iterate each player
-      for(Player p : playerSet)
-      {
-        // check if the player should not be updated
-        if ( !p || p->leftGame() || p->isDefeated() || p == thePlayer )
-          continue;
-        // add player to allies set
-        if ( thePlayer->isAlly(p) )
-          _allies.insert(p);
-        // add player to enemies set
-        if ( thePlayer->isEnemy(p) )
-          _enemies.insert(p);
-        // add player to observers set
-        if ( p->isObserver() )
-          _observers.insert(p);
-      }
-    }
     onMatchFrame();
     staticMinerals = minerals;
     staticGeysers = geysers;
@@ -236,12 +335,23 @@ namespace BWAPI
   //------------------------------------------------- ON MATCH FRAME -----------------------------------------
   void GameImpl::onMatchFrame()
   {
-    events.clear();
-    bullets.clear();
+    // hand last frame's nodes back for reuse instead of freeing them
+    while ( !events.empty() )
+    {
+      std::list<Event> &spare = hasText(events.front().getType()) ? spareTextEvents : spareEvents;
+      spare.splice(spare.end(), events, events.begin());
+    }
+    // only touch the bullet set for slots that appeared or disappeared
     for(int i = 0; i < 100; ++i)
     {
-      if (bulletVector[i].exists())
+      bool exists = bulletVector[i].exists();
+      if ( exists == bulletExists[i] )
+        continue;
+      bulletExists[i] = exists;
+      if ( exists )
         bullets.insert(&bulletVector[i]);
+      else
+        bullets.erase(&bulletVector[i]);
     }
     nukeDots.clear();
     for(int i = 0; i < data->nukeDotCount; ++i)
@@ -249,11 +359,11 @@ namespace BWAPI
 
     for(int e = 0; e < data->eventCount; ++e)
     {
-      events.push_back(this->makeEvent(data->events[e]));
+      nextEvent(data->events[e]);
       int id = data->events[e].v1;
       if (data->events[e].type == EventType::UnitDiscover)
       {
-        Unit u = &unitVector[id];
+        Unit u = getUnitImpl(id);
         accessibleUnits.insert(u);
         static_cast<PlayerImpl*>(u->getPlayer())->units.insert(u);
         if (u->getPlayer()->isNeutral())
@@ -272,8 +382,9 @@ namespace BWAPI
       }
       else if (data->events[e].type == EventType::UnitEvade)
       {
-        Unit u = &unitVector[id];
+        UnitImpl *u = getUnitImpl(id);
         accessibleUnits.erase(u);
+        unlinkUnitRelations(u);
         static_cast<PlayerImpl*>(u->getPlayer())->units.erase(u);
         if (u->getPlayer()->isNeutral())
         {
@@ -291,14 +402,14 @@ namespace BWAPI
       }
       else if (data->events[e].type==EventType::UnitRenegade)
       {
-        Unit u = &unitVector[id];
+        Unit u = getUnitImpl(id);
         for (auto &p : playerSet)
           static_cast<PlayerImpl*>(p)->units.erase(u);
         static_cast<PlayerImpl*>(u->getPlayer())->units.insert(u);
       }
       else if (data->events[e].type == EventType::UnitMorph)
       {
-        Unit u = &unitVector[id];
+        Unit u = getUnitImpl(id);
         if (u->getType() == UnitTypes::Resource_Vespene_Geyser)
         {
           geysers.insert(u);
@@ -311,28 +422,85 @@ namespace BWAPI
         }
       }
     }
-    for (Unit ui : accessibleUnits)
+    for (Unit u : accessibleUnits)
+      updateUnitRelations(static_cast<UnitImpl*>(u));
+
+    // rebuild the selection only when it differs from last frame's
+    if ( data->selectedUnitCount != (int)lastSelection.size() ||
+         !std::equal(lastSelection.begin(), lastSelection.end(), data->selectedUnits) )
     {
-      UnitImpl *u = static_cast<UnitImpl*>(ui);
-      u->connectedUnits.clear();
-      u->loadedUnits.clear();
+      lastSelection.assign(data->selectedUnits, data->selectedUnits + data->selectedUnitCount);
+      selectedUnits.clear();
+      for ( int id : lastSelection )
+      {
+        Unit u = getUnit(id);
+        if ( u )
+          selectedUnits.insert(u);
+      }
     }
-    for(Unit u : accessibleUnits)
+    updatePlayerSets();
+    this->processInterfaceEvents(); // Note sure if this should go here?
+  }
+  //------------------------------------------- UPDATE UNIT RELATIONS ----------------------------------------
+  void GameImpl::updateUnitRelations(UnitImpl *u)
+  {
+    // compare the raw ids so that unchanged units cost a few reads and no set operations
+    const UnitData *d = u->self;
+    int connectedTo = -1;
+    if ( d->type == UnitTypes::Zerg_Larva )
+      connectedTo = d->hatchery;
+    else if ( d->type == UnitTypes::Protoss_Interceptor )
+      connectedTo = d->carrier;
+    if ( connectedTo != u->connectedToID )
     {
-      if ( u->getType() == UnitTypes::Zerg_Larva && u->getHatchery() )
-        static_cast<UnitImpl*>(u->getHatchery())->connectedUnits.insert(u);
-      if ( u->getType() == UnitTypes::Protoss_Interceptor && u->getCarrier() )
-        static_cast<UnitImpl*>(u->getCarrier())->connectedUnits.insert(u);
-      if ( u->getTransport() )
-        static_cast<UnitImpl*>(u->getTransport())->loadedUnits.insert(u);
+      if ( Unit oldOwner = getUnit(u->connectedToID) )
+        static_cast<UnitImpl*>(oldOwner)->connectedUnits.erase(u);
+      if ( Unit newOwner = getUnit(connectedTo) )
+        static_cast<UnitImpl*>(newOwner)->connectedUnits.insert(u);
+      u->connectedToID = connectedTo;
     }
-    selectedUnits.clear();
-    for ( int i = 0; i < data->selectedUnitCount; ++i )
+    if ( d->transport != u->loadedIntoID )
     {
-      Unit u = getUnit(data->selectedUnits[i]);
-      if ( u )
-        selectedUnits.insert(u);
+      if ( Unit oldTransport = getUnit(u->loadedIntoID) )
+        static_cast<UnitImpl*>(oldTransport)->loadedUnits.erase(u);
+      if ( Unit newTransport = getUnit(d->transport) )
+        static_cast<UnitImpl*>(newTransport)->loadedUnits.insert(u);
+      u->loadedIntoID = d->transport;
     }
+  }
+  //------------------------------------------- UNLINK UNIT RELATIONS ----------------------------------------
+  void GameImpl::unlinkUnitRelations(UnitImpl *u)
+  {
+    if ( Unit owner = getUnit(u->connectedToID) )
+      static_cast<UnitImpl*>(owner)->connectedUnits.erase(u);
+    if ( Unit transport = getUnit(u->loadedIntoID) )
+      static_cast<UnitImpl*>(transport)->loadedUnits.erase(u);
+    u->connectedToID = -1;
+    u->loadedIntoID  = -1;
+  }
+  //------------------------------------------- UPDATE PLAYER SETS -------------------------------------------
+  void GameImpl::updatePlayerSets()
+  {
+    // defeats and alliance changes arrive without events, so pack the flags the sets
+    // depend on into a key and only rebuild them when it changes
+    unsigned long long key = thePlayer ? (unsigned long long)thePlayer->getID() << 48 : 1ULL << 63;
+    if ( thePlayer )
+    {
+      for(Player p : playerSet)
+      {
+        if ( !p )
+          continue;
+        unsigned long long flags = (p->leftGame() || p->isDefeated() || p == thePlayer ? 1 : 0) |
+                                   (thePlayer->isAlly(p) ? 2 : 0) |
+                                   (thePlayer->isEnemy(p) ? 4 : 0) |
+                                   (p->isObserver() ? 8 : 0);
+        key |= flags << (p->getID() * 4);
+      }
+    }
+    if ( key == playerSetKey )
+      return;
+    playerSetKey = key;
+
     // clear player sets
     _allies.clear();
     _enemies.clear();
@@ -356,7 +524,6 @@ namespace BWAPI
           _observers.insert(p);
       }
     }
-    this->processInterfaceEvents(); // Note sure if this should go here?
   }
   //----------------------------------------------- GET FORCE ------------------------------------------------
   Force GameImpl::getForce(int forceId) const
@@ -381,9 +548,19 @@ namespace BWAPI
   //----------------------------------------------- GET UNIT -------------------------------------------------
   Unit GameImpl::getUnit(int unitId) const
   {
-    if (static_cast<unsigned>(unitId) >= unitVector.size())
+    if (static_cast<unsigned>(unitId) >= unitTable.size())
       return nullptr;
-    return (Unit )(&unitVector[unitId]);
+    return getUnitImpl(unitId);
+  }
+  UnitImpl* GameImpl::getUnitImpl(int unitId) const
+  {
+    UnitImpl *&u = unitTable[unitId];
+    if ( !u )
+    {
+      unitPool.emplace_back(unitId);
+      u = &unitPool.back();
+    }
+    return u;
   }
   //----------------------------------------------- INDEX TO UNIT --------------------------------------------
   Unit GameImpl::indexToUnit(int unitIndex) const
@@ -624,7 +801,7 @@ namespace BWAPI
   {
     char buffer[256];
     VSNPrintf(buffer, format, arg);
-    addCommand(BWAPIC::Command(BWAPIC::CommandType::Printf,addString(buffer)));
+    addStringCommand(BWAPIC::CommandType::Printf, buffer);
     return;
   }
   //--------------------------------------------- SEND TEXT EX -----------------------------------------------
@@ -632,7 +809,7 @@ namespace BWAPI
   {
     char buffer[256];
     VSNPrintf(buffer, format, arg);
-    addCommand(BWAPIC::Command(BWAPIC::CommandType::SendText, addString(buffer), toAllies ? 1 : 0));
+    addStringCommand(BWAPIC::CommandType::SendText, buffer, toAllies ? 1 : 0);
   }
   //----------------------------------------------- IS IN GAME -----------------------------------------------
   bool GameImpl::isInGame() const
@@ -781,9 +958,11 @@ namespace BWAPI
   void GameImpl::vDrawText(CoordinateType::Enum ctype, int x, int y, const char *format, va_list arg)
   {
     if ( !data->hasGUI ) return;
+    BWAPIC::Shape s(BWAPIC::ShapeType::Text,ctype,x,y,0,0,0,textSize,0,false);
+    // Skip formatting text that would be culled or dropped anyway
+    if ( !hasShapeRoom(s) ) return;
     char buffer[2048];
     VSNPrintf(buffer, format, arg);
-    BWAPIC::Shape s(BWAPIC::ShapeType::Text,ctype,x,y,0,0,0,textSize,0,false);
     addText(s,buffer);
   }
   //--------------------------------------------------- DRAW BOX ---------------------------------------------
@@ -889,7 +1068,8 @@ namespace BWAPI
     if (!std::ifstream(mapFileName).is_open())
       return setLastError(Errors::File_Not_Found);
 
-    addCommand( BWAPIC::Command(BWAPIC::CommandType::SetMap, addString(mapFileName)) );
+    if ( addStringCommand(BWAPIC::CommandType::SetMap, mapFileName) < 0 )
+      return setLastError(Errors::Insufficient_Space);
     return setLastError();
   }
   int GameImpl::elapsedTime() const
@@ -0,0 +1,200 @@
+#ifdef __linux__
+#include <BWAPI/Client/Transport.h>
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace BWAPI
+{
+  // Sits at the start of the shared memory object, ahead of the game data. Each side only ever
+  // increments its own counter, and waits for the other's to move.
+  struct SharedMemoryTransport::Handshake
+  {
+    int toServer;       // bumped by the client when it hands a frame back
+    int toClient;       // bumped by the server when a frame is ready
+    int serverProcID;
+    int clientProcID;
+  };
+
+  namespace
+  {
+    // keeps the game data on its own cache lines, away from the futex words
+    const size_t HANDSHAKE_SIZE = 64;
+    // polls before falling back to sleeping on the futex; most hand-offs land within this
+    const int SPIN_COUNT = 2000;
+    // how long to sleep before checking that the other side is still alive
+    const long WAIT_TIMEOUT_NS = 100 * 1000 * 1000;
+
+    std::string sharedMemoryName(int serverProcID)
+    {
+      std::stringstream name;
+      name << "/bwapi_shared_memory_" << serverProcID;
+      return name.str();
+    }
+    int futexWait(int *address, int expected, const timespec *timeout)
+    {
+      return (int)syscall(SYS_futex, address, FUTEX_WAIT, expected, timeout, nullptr, 0);
+    }
+    void futexWake(int *address)
+    {
+      syscall(SYS_futex, address, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+    bool processAlive(int procID)
+    {
+      return procID <= 0 || kill(procID, 0) == 0 || errno != ESRCH;
+    }
+    inline void cpuRelax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+      __builtin_ia32_pause();
+#endif
+    }
+  }
+
+  SharedMemoryTransport::SharedMemoryTransport(int serverProcID, Role role)
+    : serverProcID(serverProcID)
+    , role(role)
+  {}
+  SharedMemoryTransport::~SharedMemoryTransport()
+  {
+    this->close();
+  }
+  bool SharedMemoryTransport::open()
+  {
+    if ( serverProcID == 0 && role == ClientRole )
+    {
+      const char *pid = std::getenv("BWAPI_SERVER_PID");
+      if ( pid )
+        serverProcID = std::atoi(pid);
+    }
+    if ( serverProcID <= 0 )
+    {
+      std::cerr << "No server proc ID" << std::endl;
+      return false;
+    }
+
+    std::string name = sharedMemoryName(serverProcID);
+    size_t size = HANDSHAKE_SIZE + sizeof(GameData);
+    if ( role == ServerRole )
+    {
+      fileDescriptor = shm_open(name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+      if ( fileDescriptor != -1 && ftruncate(fileDescriptor, (off_t)size) != 0 )
+      {
+        ::close(fileDescriptor);
+        fileDescriptor = -1;
+      }
+    }
+    else
+    {
+      fileDescriptor = shm_open(name.c_str(), O_RDWR, 0600);
+    }
+    if ( fileDescriptor == -1 )
+    {
+      std::cerr << "Unable to open shared memory object: " << name << std::endl;
+      return false;
+    }
+
+    mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    if ( mapping == MAP_FAILED )
+    {
+      mapping = nullptr;
+      std::cerr << "Unable to map game data." << std::endl;
+      this->close();
+      return false;
+    }
+    handshake = static_cast<Handshake*>(mapping);
+    data      = reinterpret_cast<GameData*>(static_cast<char*>(mapping) + HANDSHAKE_SIZE);
+
+    if ( role == ServerRole )
+    {
+      handshake->serverProcID = serverProcID;
+      handshake->clientProcID = 0;
+    }
+    else
+    {
+      __atomic_store_n(&handshake->clientProcID, (int)getpid(), __ATOMIC_RELEASE);
+    }
+    // the server may have readied the first frame before we attached, so the client counts from zero
+    lastSeen = role == ServerRole ? __atomic_load_n(&handshake->toServer, __ATOMIC_ACQUIRE) : 0;
+    return true;
+  }
+  void SharedMemoryTransport::close()
+  {
+    if ( mapping )
+      munmap(mapping, HANDSHAKE_SIZE + sizeof(GameData));
+    mapping   = nullptr;
+    handshake = nullptr;
+    data      = nullptr;
+
+    if ( fileDescriptor != -1 )
+    {
+      ::close(fileDescriptor);
+      if ( role == ServerRole )
+        shm_unlink(sharedMemoryName(serverProcID).c_str());
+    }
+    fileDescriptor = -1;
+  }
+  GameData* SharedMemoryTransport::getData() const
+  {
+    return data;
+  }
+  bool SharedMemoryTransport::signal()
+  {
+    if ( !handshake )
+      return false;
+    int *outgoing = role == ServerRole ? &handshake->toClient : &handshake->toServer;
+    __atomic_fetch_add(outgoing, 1, __ATOMIC_RELEASE);
+    futexWake(outgoing);
+    return true;
+  }
+  bool SharedMemoryTransport::wait()
+  {
+    if ( !handshake )
+      return false;
+    int *incoming = role == ServerRole ? &handshake->toServer : &handshake->toClient;
+
+    for ( int i = 0; i < SPIN_COUNT; ++i )
+    {
+      int value = __atomic_load_n(incoming, __ATOMIC_ACQUIRE);
+      if ( value != lastSeen )
+      {
+        lastSeen = value;
+        return true;
+      }
+      cpuRelax();
+    }
+
+    timespec timeout;
+    timeout.tv_sec  = 0;
+    timeout.tv_nsec = WAIT_TIMEOUT_NS;
+    while ( true )
+    {
+      int value = __atomic_load_n(incoming, __ATOMIC_ACQUIRE);
+      if ( value != lastSeen )
+      {
+        lastSeen = value;
+        return true;
+      }
+      // the kernel rechecks the word before sleeping, so a signal between the load and here isn't lost
+      if ( futexWait(incoming, value, &timeout) == -1 && errno == ETIMEDOUT )
+      {
+        int peer = role == ServerRole ? __atomic_load_n(&handshake->clientProcID, __ATOMIC_ACQUIRE) : handshake->serverProcID;
+        if ( !processAlive(peer) )
+          return false;
+      }
+    }
+  }
+}
+#endif
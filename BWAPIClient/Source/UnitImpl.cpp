@@ -11,9 +11,75 @@
 #include <string>
 namespace BWAPI
 {
+  //---------------------------------------------- POOLED UNITSET --------------------------------------------
+  namespace
+  {
+    // Emptied sets waiting to be reused; the client is single threaded. Never destroyed, since
+    // units can still be releasing sets while the client global is torn down at exit.
+    std::vector<Unitset*> &freeUnitsets()
+    {
+      static std::vector<Unitset*> *sets = new std::vector<Unitset*>();
+      return *sets;
+    }
+    const Unitset &emptyUnitset()
+    {
+      static const Unitset *empty = new Unitset();
+      return *empty;
+    }
+  }
+  PooledUnitset::PooledUnitset()
+    : set(nullptr)
+  {}
+  PooledUnitset::~PooledUnitset()
+  {
+    clear();
+  }
+  void PooledUnitset::insert(Unit unit)
+  {
+    if ( !set )
+    {
+      std::vector<Unitset*> &sets = freeUnitsets();
+      if ( sets.empty() )
+      {
+        set = new Unitset();
+      }
+      else
+      {
+        set = sets.back();
+        sets.pop_back();
+      }
+    }
+    set->insert(unit);
+  }
+  void PooledUnitset::erase(Unit unit)
+  {
+    if ( !set )
+      return;
+    set->erase(unit);
+    if ( set->empty() )
+      clear();
+  }
+  void PooledUnitset::clear()
+  {
+    if ( !set )
+      return;
+    set->clear();
+    freeUnitsets().push_back(set);
+    set = nullptr;
+  }
+  size_t PooledUnitset::size() const
+  {
+    return set ? set->size() : 0;
+  }
+  PooledUnitset::operator const Unitset&() const
+  {
+    return set ? *set : emptyUnitset();
+  }
   UnitImpl::UnitImpl(int _id)
     : id(_id)
     , self(&(BWAPI::BWAPIClient.data->units[_id]))
+    , connectedToID(-1)
+    , loadedIntoID(-1)
   {
     clear();
   }
@@ -0,0 +1,223 @@
+// A unit that lives outside any game, for timing the parts of BWAPILIB that only need a
+// unit's id, type, position and hit points. It exists and is completed; every other query
+// answers as an idle unit would, and every command is refused.
+#pragma once
+#include <BWAPI.h>
+
+namespace BWAPI
+{
+  class BenchmarkUnit : public UnitInterface
+  {
+    int id;
+    UnitType type;
+    Position position;
+    int hitPoints;
+  public:
+    BenchmarkUnit(int id, UnitType type, Position position)
+      : id(id), type(type), position(position), hitPoints(type.maxHitPoints())
+    {}
+    virtual ~BenchmarkUnit() {}
+
+    //------------------------------------------- UNIT INTERFACE -----------------------------------------------
+    // One override per pure virtual in BWAPI/Unit.h, in the same order
+    virtual int getID() const override { return id; }
+    virtual bool exists() const override { return true; }
+    virtual int getReplayID() const override { return 0; }
+    virtual Player getPlayer() const override { return Player(); }
+    virtual UnitType getType() const override { return type; }
+    virtual Position getPosition() const override { return position; }
+    virtual double getAngle() const override { return 0.0; }
+    virtual double getVelocityX() const override { return 0.0; }
+    virtual double getVelocityY() const override { return 0.0; }
+    virtual int getHitPoints() const override { return hitPoints; }
+    virtual int getShields() const override { return 0; }
+    virtual int getEnergy() const override { return 0; }
+    virtual int getResources() const override { return 0; }
+    virtual int getResourceGroup() const override { return 0; }
+    virtual int getLastCommandFrame() const override { return 0; }
+    virtual UnitCommand getLastCommand() const override { return UnitCommand(); }
+    virtual BWAPI::Player getLastAttackingPlayer() const override { return BWAPI::Player(); }
+    virtual UnitType getInitialType() const override { return UnitType(); }
+    virtual Position getInitialPosition() const override { return Position(); }
+    virtual TilePosition getInitialTilePosition() const override { return TilePosition(); }
+    virtual int getInitialHitPoints() const override { return 0; }
+    virtual int getInitialResources() const override { return 0; }
+    virtual int getKillCount() const override { return 0; }
+    virtual int getAcidSporeCount() const override { return 0; }
+    virtual int getInterceptorCount() const override { return 0; }
+    virtual int getScarabCount() const override { return 0; }
+    virtual int getSpiderMineCount() const override { return 0; }
+    virtual int getGroundWeaponCooldown() const override { return 0; }
+    virtual int getAirWeaponCooldown() const override { return 0; }
+    virtual int getSpellCooldown() const override { return 0; }
+    virtual int getDefenseMatrixPoints() const override { return 0; }
+    virtual int getDefenseMatrixTimer() const override { return 0; }
+    virtual int getEnsnareTimer() const override { return 0; }
+    virtual int getIrradiateTimer() const override { return 0; }
+    virtual int getLockdownTimer() const override { return 0; }
+    virtual int getMaelstromTimer() const override { return 0; }
+    virtual int getOrderTimer() const override { return 0; }
+    virtual int getPlagueTimer() const override { return 0; }
+    virtual int getRemoveTimer() const override { return 0; }
+    virtual int getStasisTimer() const override { return 0; }
+    virtual int getStimTimer() const override { return 0; }
+    virtual UnitType getBuildType() const override { return UnitType(); }
+    virtual UnitType::list getTrainingQueue() const override { return UnitType::list(); }
+    virtual TechType getTech() const override { return TechType(); }
+    virtual UpgradeType getUpgrade() const override { return UpgradeType(); }
+    virtual int getRemainingBuildTime() const override { return 0; }
+    virtual int getRemainingTrainTime() const override { return 0; }
+    virtual int getRemainingResearchTime() const override { return 0; }
+    virtual int getRemainingUpgradeTime() const override { return 0; }
+    virtual Unit getBuildUnit() const override { return Unit(); }
+    virtual Unit getTarget() const override { return Unit(); }
+    virtual Position getTargetPosition() const override { return Position(); }
+    virtual Order getOrder() const override { return Order(); }
+    virtual Order getSecondaryOrder() const override { return Order(); }
+    virtual Unit getOrderTarget() const override { return Unit(); }
+    virtual Position getOrderTargetPosition() const override { return Position(); }
+    virtual Position getRallyPosition() const override { return Position(); }
+    virtual Unit getRallyUnit() const override { return Unit(); }
+    virtual Unit getAddon() const override { return Unit(); }
+    virtual Unit getNydusExit() const override { return Unit(); }
+    virtual Unit getPowerUp() const override { return Unit(); }
+    virtual Unit getTransport() const override { return Unit(); }
+    virtual Unitset getLoadedUnits() const override { return Unitset(); }
+    virtual Unit getCarrier() const override { return Unit(); }
+    virtual Unitset getInterceptors() const override { return Unitset(); }
+    virtual Unit getHatchery() const override { return Unit(); }
+    virtual Unitset getLarva() const override { return Unitset(); }
+    virtual bool hasNuke() const override { return false; }
+    virtual bool isAccelerating() const override { return false; }
+    virtual bool isAttacking() const override { return false; }
+    virtual bool isAttackFrame() const override { return false; }
+    virtual bool isBeingGathered() const override { return false; }
+    virtual bool isBeingHealed() const override { return false; }
+    virtual bool isBlind() const override { return false; }
+    virtual bool isBraking() const override { return false; }
+    virtual bool isBurrowed() const override { return false; }
+    virtual bool isCarryingGas() const override { return false; }
+    virtual bool isCarryingMinerals() const override { return false; }
+    virtual bool isCloaked() const override { return false; }
+    virtual bool isCompleted() const override { return true; }
+    virtual bool isConstructing() const override { return false; }
+    virtual bool isDetected() const override { return false; }
+    virtual bool isGatheringGas() const override { return false; }
+    virtual bool isGatheringMinerals() const override { return false; }
+    virtual bool isHallucination() const override { return false; }
+    virtual bool isIdle() const override { return false; }
+    virtual bool isInterruptible() const override { return false; }
+    virtual bool isInvincible() const override { return false; }
+    virtual bool isLifted() const override { return false; }
+    virtual bool isMorphing() const override { return false; }
+    virtual bool isMoving() const override { return false; }
+    virtual bool isParasited() const override { return false; }
+    virtual bool isSelected() const override { return false; }
+    virtual bool isStartingAttack() const override { return false; }
+    virtual bool isStuck() const override { return false; }
+    virtual bool isTraining() const override { return false; }
+    virtual bool isUnderAttack() const override { return false; }
+    virtual bool isUnderDarkSwarm() const override { return false; }
+    virtual bool isUnderDisruptionWeb() const override { return false; }
+    virtual bool isUnderStorm() const override { return false; }
+    virtual bool isPowered() const override { return false; }
+    virtual bool isVisible(Player) const override { return false; }
+    virtual bool isTargetable() const override { return false; }
+    virtual bool issueCommand(UnitCommand) override { return false; }
+    virtual bool canIssueCommand(UnitCommand, bool, bool, bool, bool, bool, bool) const override { return false; }
+    virtual bool canIssueCommandGrouped(UnitCommand, bool, bool, bool, bool, bool, bool) const override { return false; }
+    virtual bool canCommand() const override { return false; }
+    virtual bool canCommandGrouped(bool) const override { return false; }
+    virtual bool canIssueCommandType(UnitCommandType, bool) const override { return false; }
+    virtual bool canIssueCommandTypeGrouped(UnitCommandType, bool, bool) const override { return false; }
+    virtual bool canTargetUnit(Unit, bool) const override { return false; }
+    virtual bool canAttack(bool) const override { return false; }
+    virtual bool canAttack(PositionOrUnit, bool, bool, bool) const override { return false; }
+    virtual bool canAttackGrouped(bool, bool) const override { return false; }
+    virtual bool canAttackGrouped(PositionOrUnit, bool, bool, bool, bool) const override { return false; }
+    virtual bool canAttackMove(bool) const override { return false; }
+    virtual bool canAttackMoveGrouped(bool, bool) const override { return false; }
+    virtual bool canAttackUnit(bool) const override { return false; }
+    virtual bool canAttackUnit(Unit, bool, bool, bool) const override { return false; }
+    virtual bool canAttackUnitGrouped(bool, bool) const override { return false; }
+    virtual bool canAttackUnitGrouped(Unit, bool, bool, bool, bool) const override { return false; }
+    virtual bool canBuild(bool) const override { return false; }
+    virtual bool canBuild(UnitType, bool, bool) const override { return false; }
+    virtual bool canBuild(UnitType, BWAPI::TilePosition, bool, bool, bool) const override { return false; }
+    virtual bool canBuildAddon(bool) const override { return false; }
+    virtual bool canBuildAddon(UnitType, bool, bool) const override { return false; }
+    virtual bool canTrain(bool) const override { return false; }
+    virtual bool canTrain(UnitType, bool, bool) const override { return false; }
+    virtual bool canMorph(bool) const override { return false; }
+    virtual bool canMorph(UnitType, bool, bool) const override { return false; }
+    virtual bool canResearch(bool) const override { return false; }
+    virtual bool canResearch(TechType, bool) const override { return false; }
+    virtual bool canUpgrade(bool) const override { return false; }
+    virtual bool canUpgrade(UpgradeType, bool) const override { return false; }
+    virtual bool canSetRallyPoint(bool) const override { return false; }
+    virtual bool canSetRallyPoint(PositionOrUnit, bool, bool, bool) const override { return false; }
+    virtual bool canSetRallyPosition(bool) const override { return false; }
+    virtual bool canSetRallyUnit(bool) const override { return false; }
+    virtual bool canSetRallyUnit(Unit, bool, bool, bool) const override { return false; }
+    virtual bool canMove(bool) const override { return false; }
+    virtual bool canMoveGrouped(bool, bool) const override { return false; }
+    virtual bool canPatrol(bool) const override { return false; }
+    virtual bool canPatrolGrouped(bool, bool) const override { return false; }
+    virtual bool canFollow(bool) const override { return false; }
+    virtual bool canFollow(Unit, bool, bool, bool) const override { return false; }
+    virtual bool canGather(bool) const override { return false; }
+    virtual bool canGather(Unit, bool, bool, bool) const override { return false; }
+    virtual bool canReturnCargo(bool) const override { return false; }
+    virtual bool canHoldPosition(bool) const override { return false; }
+    virtual bool canStop(bool) const override { return false; }
+    virtual bool canRepair(bool) const override { return false; }
+    virtual bool canRepair(Unit, bool, bool, bool) const override { return false; }
+    virtual bool canBurrow(bool) const override { return false; }
+    virtual bool canUnburrow(bool) const override { return false; }
+    virtual bool canCloak(bool) const override { return false; }
+    virtual bool canDecloak(bool) const override { return false; }
+    virtual bool canSiege(bool) const override { return false; }
+    virtual bool canUnsiege(bool) const override { return false; }
+    virtual bool canLift(bool) const override { return false; }
+    virtual bool canLand(bool) const override { return false; }
+    virtual bool canLand(TilePosition, bool, bool) const override { return false; }
+    virtual bool canLoad(bool) const override { return false; }
+    virtual bool canLoad(Unit, bool, bool, bool) const override { return false; }
+    virtual bool canUnloadWithOrWithoutTarget(bool) const override { return false; }
+    virtual bool canUnloadAtPosition(Position, bool, bool) const override { return false; }
+    virtual bool canUnload(bool) const override { return false; }
+    virtual bool canUnload(Unit, bool, bool, bool, bool) const override { return false; }
+    virtual bool canUnloadAll(bool) const override { return false; }
+    virtual bool canUnloadAllPosition(bool) const override { return false; }
+    virtual bool canUnloadAllPosition(Position, bool, bool) const override { return false; }
+    virtual bool canRightClick(bool) const override { return false; }
+    virtual bool canRightClick(PositionOrUnit, bool, bool, bool) const override { return false; }
+    virtual bool canRightClickGrouped(bool, bool) const override { return false; }
+    virtual bool canRightClickGrouped(PositionOrUnit, bool, bool, bool, bool) const override { return false; }
+    virtual bool canRightClickPosition(bool) const override { return false; }
+    virtual bool canRightClickPositionGrouped(bool, bool) const override { return false; }
+    virtual bool canRightClickUnit(bool) const override { return false; }
+    virtual bool canRightClickUnit(Unit, bool, bool, bool) const override { return false; }
+    virtual bool canRightClickUnitGrouped(bool, bool) const override { return false; }
+    virtual bool canRightClickUnitGrouped(Unit, bool, bool, bool, bool) const override { return false; }
+    virtual bool canHaltConstruction(bool) const override { return false; }
+    virtual bool canCancelConstruction(bool) const override { return false; }
+    virtual bool canCancelAddon(bool) const override { return false; }
+    virtual bool canCancelTrain(bool) const override { return false; }
+    virtual bool canCancelTrainSlot(bool) const override { return false; }
+    virtual bool canCancelTrainSlot(int, bool, bool) const override { return false; }
+    virtual bool canCancelMorph(bool) const override { return false; }
+    virtual bool canCancelResearch(bool) const override { return false; }
+    virtual bool canCancelUpgrade(bool) const override { return false; }
+    virtual bool canUseTechWithOrWithoutTarget(bool) const override { return false; }
+    virtual bool canUseTechWithOrWithoutTarget(BWAPI::TechType, bool, bool) const override { return false; }
+    virtual bool canUseTech(BWAPI::TechType, PositionOrUnit, bool, bool, bool, bool) const override { return false; }
+    virtual bool canUseTechWithoutTarget(BWAPI::TechType, bool, bool) const override { return false; }
+    virtual bool canUseTechUnit(BWAPI::TechType, bool, bool) const override { return false; }
+    virtual bool canUseTechUnit(BWAPI::TechType, Unit, bool, bool, bool, bool) const override { return false; }
+    virtual bool canUseTechPosition(BWAPI::TechType, bool, bool) const override { return false; }
+    virtual bool canUseTechPosition(BWAPI::TechType, Position, bool, bool, bool) const override { return false; }
+    virtual bool canPlaceCOP(bool) const override { return false; }
+    virtual bool canPlaceCOP(TilePosition, bool, bool) const override { return false; }
+  };
+}
@@ -0,0 +1,266 @@
+// Times the BWAPILIB primitives a bot leans on every frame, and counts the heap allocations
+// each one makes, so that a change that slows one of them down or makes it allocate shows up
+// as a different number here.
+//
+// Units are BenchmarkUnits placed on a 128x128 map, either at random or from a recording made
+// in a real game: a text file with one unit per line, "<type name> <x> <y>", such as
+//   Terran_Marine 1040 2212
+// which any bot can write by printing getType(), getPosition().x and getPosition().y of each
+// unit on a frame of interest.
+//
+// Build with the PrimitivesBenchmark project in TerranProject.sln, or on Linux with
+//   make -C BWAPILIB/Benchmark
+// Both compile BWAPILIB from source, so the numbers reflect the library in this tree.
+//
+// Usage: PrimitivesBenchmark [units | recording] [milliseconds per benchmark]
+#include <BWAPI.h>
+#include "BenchmarkUnit.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace BWAPI;
+using namespace Filter;
+
+//------------------------------------------- ALLOCATION COUNTING ------------------------------------------
+// The benchmark is single threaded, so a plain counter will do
+static long long allocations = 0;
+
+void *operator new(std::size_t size)
+{
+  ++allocations;
+  if ( void *p = std::malloc(size ? size : 1) )
+    return p;
+  throw std::bad_alloc();
+}
+void *operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+void operator delete(void *p) throw()
+{
+  std::free(p);
+}
+void operator delete[](void *p) throw()
+{
+  std::free(p);
+}
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock Clock;
+
+  // Keeps results alive so the optimizer can't drop the work that produced them
+  volatile long long sink;
+
+  double budgetMs = 200;
+
+  //------------------------------------------------ HARNESS -----------------------------------------------
+  // Runs the body, which performs ops operations, until the budget is spent, and reports the
+  // time and allocations per operation. The first run is a warm-up and isn't counted.
+  template <class Body>
+  void measure(const char *name, int ops, Body body)
+  {
+    sink += body();
+    long long runs = 0;
+    long long allocated = allocations;
+    auto start = Clock::now();
+    double elapsedMs = 0;
+    do
+    {
+      sink += body();
+      ++runs;
+      elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    } while ( elapsedMs < budgetMs );
+    double totalOps = static_cast<double>(runs) * ops;
+    std::printf("%-52s %10.2f ns/op %8.2f allocs/op\n", name,
+                elapsedMs * 1e6 / totalOps, (allocations - allocated) / totalOps);
+  }
+
+  //-------------------------------------------------- DATA ------------------------------------------------
+  // Unit types weighted like a game in progress: mostly army and workers, then buildings
+  std::vector<UnitType> typePool()
+  {
+    std::vector<UnitType> pool;
+    for ( UnitType t : UnitTypes::allUnitTypes() )
+    {
+      if ( t.isHero() || t.isSpecialBuilding() || t.isNeutral() || t.getRace() == Races::None )
+        continue;
+      int weight = t.isWorker() ? 8 : t.isBuilding() ? 1 : 3;
+      pool.insert(pool.end(), weight, t);
+    }
+    return pool;
+  }
+
+  void makeSyntheticUnits(int count, std::vector<BenchmarkUnit> &units)
+  {
+    std::vector<UnitType> pool = typePool();
+    std::mt19937 rng(12345);
+    std::uniform_int_distribution<int> coord(0, 128 * 32 - 1);
+    std::uniform_int_distribution<int> pick(0, static_cast<int>(pool.size()) - 1);
+    for ( int i = 0; i < count; ++i )
+      units.push_back(BenchmarkUnit(i, pool[pick(rng)], Position(coord(rng), coord(rng))));
+  }
+
+  bool loadRecordedUnits(const char *path, std::vector<BenchmarkUnit> &units)
+  {
+    std::ifstream in(path);
+    if ( !in )
+      return false;
+    std::string name;
+    int x, y;
+    while ( in >> name >> x >> y )
+    {
+      UnitType type = UnitType::getType(name);
+      if ( type != UnitTypes::Unknown )
+        units.push_back(BenchmarkUnit(static_cast<int>(units.size()), type, Position(x, y)));
+    }
+    return !units.empty();
+  }
+}
+
+int main(int argc, const char *argv[])
+{
+  std::vector<BenchmarkUnit> storage;
+  storage.reserve(100000);
+  const char *source = argc > 1 ? argv[1] : "2000";
+  bool recorded = loadRecordedUnits(source, storage);
+  if ( !recorded )
+    makeSyntheticUnits(std::max(2, std::atoi(source)), storage);
+  if ( argc > 2 )
+    budgetMs = std::atof(argv[2]);
+
+  std::vector<Unit> units;
+  for ( BenchmarkUnit &u : storage )
+    units.push_back(&u);
+  const int count = static_cast<int>(units.size());
+
+  Unitset set;
+  for ( Unit u : units )
+    set.insert(u);
+
+  // Pairs of units and positions, in a fixed random order
+  std::vector<std::pair<int, int>> pairs;
+  std::mt19937 rng(54321);
+  for ( int i = 0; i < 4096; ++i )
+    pairs.push_back(std::make_pair(static_cast<int>(rng() % count), static_cast<int>(rng() % count)));
+  const int pairCount = static_cast<int>(pairs.size());
+
+  std::vector<std::string> names;
+  for ( UnitType t : UnitTypes::allUnitTypes() )
+    names.push_back(t.getName());
+  const int nameCount = static_cast<int>(names.size());
+
+  std::printf("%d units from %s\n\n", count, recorded ? source : "random placement");
+
+  //------------------------------------------------ UNITSET -----------------------------------------------
+  measure("Unitset::insert", count, [&]()
+  {
+    Unitset s;
+    for ( Unit u : units )
+      s.insert(u);
+    return static_cast<long long>(s.size());
+  });
+  measure("Unitset iterate", count, [&]()
+  {
+    long long sum = 0;
+    for ( Unit u : set )
+      sum += u->getID();
+    return sum;
+  });
+  measure("Unitset::getPosition", count, [&]()
+  {
+    Position p = set.getPosition();
+    return static_cast<long long>(p.x + p.y);
+  });
+
+  //------------------------------------------------ FILTERS -----------------------------------------------
+  measure("Unitset filter, hand-written", count, [&]()
+  {
+    long long matches = 0;
+    for ( Unit u : set )
+      matches += u->getType().isWorker() && u->isCompleted() && u->getHitPoints() > 20;
+    return matches;
+  });
+  const UnitFilter composed = IsWorker && IsCompleted && HP > 20;
+  measure("Unitset filter, IsWorker && IsCompleted && HP > 20", count, [&]()
+  {
+    long long matches = 0;
+    for ( Unit u : set )
+      matches += composed(u);
+    return matches;
+  });
+  measure("Unitset filter, GetType == Terran_Marine", count, [&]()
+  {
+    long long matches = 0;
+    for ( Unit u : set )
+      matches += (GetType == UnitTypes::Terran_Marine)(u);
+    return matches;
+  });
+  measure("UnaryFilter compose (3 terms)", 1, [&]()
+  {
+    UnitFilter f = IsWorker && IsCompleted && HP > 20;
+    return static_cast<long long>(f(units[0]));
+  });
+
+  //----------------------------------------------- DISTANCES ----------------------------------------------
+  measure("Position::getDistance", pairCount, [&]()
+  {
+    double sum = 0;
+    for ( auto &p : pairs )
+      sum += units[p.first]->getPosition().getDistance(units[p.second]->getPosition());
+    return static_cast<long long>(sum);
+  });
+  measure("Position::getApproxDistance", pairCount, [&]()
+  {
+    long long sum = 0;
+    for ( auto &p : pairs )
+      sum += units[p.first]->getPosition().getApproxDistance(units[p.second]->getPosition());
+    return sum;
+  });
+  measure("UnitInterface::getDistance(Unit)", pairCount, [&]()
+  {
+    long long sum = 0;
+    for ( auto &p : pairs )
+      sum += units[p.first]->getDistance(units[p.second]);
+    return sum;
+  });
+  measure("UnitInterface::getDistance(Position)", pairCount, [&]()
+  {
+    long long sum = 0;
+    for ( auto &p : pairs )
+      sum += units[p.first]->getDistance(units[p.second]->getPosition());
+    return sum;
+  });
+
+  //------------------------------------------------- TYPES ------------------------------------------------
+  measure("UnitType::requiredUnits", count, [&]()
+  {
+    long long sum = 0;
+    for ( Unit u : units )
+      sum += u->getType().requiredUnits().size();
+    return sum;
+  });
+  measure("UnitType::getType(name)", nameCount, [&]()
+  {
+    long long sum = 0;
+    for ( auto &n : names )
+      sum += UnitType::getType(n);
+    return sum;
+  });
+  measure("UnitType::getName", count, [&]()
+  {
+    long long sum = 0;
+    for ( Unit u : units )
+      sum += u->getType().getName().size();
+    return sum;
+  });
+  return 0;
+}
@@ -0,0 +1,108 @@
+// Times the hot unit type filters two ways over a large batch of unit types: through the
+// UnitType accessors, one call per property per unit, and through UnitTypeTable, one masked
+// load per unit.
+//
+// Build with the UnitTypeFilterBenchmark project in TerranProject.sln, or on Linux with
+//   make -C BWAPILIB/Benchmark
+// Both compile BWAPILIB from source, so the numbers reflect the library in this tree.
+//
+// Usage: UnitTypeFilterBenchmark [units] [passes]
+#include <BWAPI.h>
+#include <BWAPI/UnitTypeTable.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace BWAPI;
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock Clock;
+
+  // Runs the filter over every unit for the given number of passes, and reports the time per unit
+  template <class Filter>
+  void run(const char *name, const std::vector<int> &typeIds, int passes, Filter filter)
+  {
+    int matches = 0;
+    auto start = Clock::now();
+    for ( int p = 0; p < passes; ++p )
+      matches += filter(typeIds.data(), static_cast<int>(typeIds.size()));
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    std::printf("%-36s %6.2f ns/unit  (%d matches)\n", name, ns / (static_cast<double>(typeIds.size()) * passes), matches / passes);
+  }
+
+  // Counts the units whose type has every flag in the mask; written so the loop vectorizes
+  int countWithFlags(const int *typeIds, int count, unsigned mask)
+  {
+    const unsigned *flags = unitTypeTable.flags;
+    int matches = 0;
+    for ( int i = 0; i < count; ++i )
+      matches += (flags[typeIds[i]] & mask) == mask;
+    return matches;
+  }
+}
+
+int main(int argc, const char *argv[])
+{
+  int units  = argc > 1 ? std::atoi(argv[1]) : 100000;
+  int passes = argc > 2 ? std::atoi(argv[2]) : 200;
+
+  // A spread of real unit types, weighted like a game in progress: mostly army and workers,
+  // then buildings
+  std::vector<int> pool;
+  for ( UnitType t : UnitTypes::allUnitTypes() )
+  {
+    if ( t.isHero() || t.isSpecialBuilding() || t.isNeutral() || t.getRace() == Races::None )
+      continue;
+    int weight = t.isWorker() ? 8 : t.isBuilding() ? 1 : 3;
+    for ( int w = 0; w < weight; ++w )
+      pool.push_back(t.getID());
+  }
+  std::srand(1);
+  std::vector<int> typeIds(units);
+  for ( int &id : typeIds )
+    id = pool[std::rand() % pool.size()];
+
+  run("IsWorker (accessor)", typeIds, passes, [](const int *ids, int n) {
+    int m = 0;
+    for ( int i = 0; i < n; ++i )
+      m += UnitType(ids[i]).isWorker();
+    return m;
+  });
+  run("IsWorker (table)", typeIds, passes, [](const int *ids, int n) {
+    return countWithFlags(ids, n, UnitTypeFlags::Worker);
+  });
+  run("IsBuilding (accessor)", typeIds, passes, [](const int *ids, int n) {
+    int m = 0;
+    for ( int i = 0; i < n; ++i )
+      m += UnitType(ids[i]).isBuilding();
+    return m;
+  });
+  run("IsBuilding (table)", typeIds, passes, [](const int *ids, int n) {
+    return countWithFlags(ids, n, UnitTypeFlags::Building);
+  });
+  run("IsResourceDepot (accessor)", typeIds, passes, [](const int *ids, int n) {
+    int m = 0;
+    for ( int i = 0; i < n; ++i )
+      m += UnitType(ids[i]).isResourceDepot();
+    return m;
+  });
+  run("IsResourceDepot (table)", typeIds, passes, [](const int *ids, int n) {
+    return countWithFlags(ids, n, UnitTypeFlags::ResourceDepot);
+  });
+  run("IsOrganic && CanMove (accessor)", typeIds, passes, [](const int *ids, int n) {
+    int m = 0;
+    for ( int i = 0; i < n; ++i )
+    {
+      UnitType t(ids[i]);
+      m += t.isOrganic() && t.canMove();
+    }
+    return m;
+  });
+  run("IsOrganic && CanMove (table)", typeIds, passes, [](const int *ids, int n) {
+    return countWithFlags(ids, n, UnitTypeFlags::OrganicUnit | UnitTypeFlags::AutoAttackAndMove);
+  });
+  return 0;
+}
@@ -41,15 +41,17 @@ namespace BWAPI
 
     type = other.type;
     position = other.position;
-    if ( text != nullptr )
+    // reuse our own string when we have one rather than reallocating it
+    if ( other.text == nullptr )
     {
       delete text;
       text = nullptr;
     }
-    
-    if ( other.text != nullptr )
+    else if ( text != nullptr )
+      *text = *other.text;
+    else
       text = new std::string(*other.text);
-      
+
     unit    = other.unit;
     player  = other.player;
     winner  = other.winner;
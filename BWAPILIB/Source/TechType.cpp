@@ -4,6 +4,7 @@
 #include <BWAPI/Order.h>
 #include <BWAPI/UnitType.h>
 #include <BWAPI/WeaponType.h>
+#include <BWAPI/TypeTraits.h>
 
 #include "Common.h"
 
@@ -60,12 +61,28 @@ namespace BWAPI
   std::string techLocalNames[TechTypes::Enum::MAX];
 
   // DEFAULTS
-  static const int defaultOreCost[TechTypes::Enum::MAX] =         // Same as default gas cost
-  { 100, 200, 200, 100, 0, 150, 0, 200, 100, 150, 100, 100, 0, 100, 0, 200, 100, 100, 0, 200, 150, 150, 150, 0, 100, 200, 0, 200, 0, 100, 100, 100, 200 };
+  // Each table is expanded from TechTypeData.inl through TechTypeTraits, so the tables
+  // and the compile-time traits cannot disagree.
+#define BWAPI_TECH_TYPE(id, ...) TechTypeTraits<id>::BWAPI_TECH_FIELD,
+  static const int defaultOreCost[TechTypes::Enum::MAX] =
+  {
+#define BWAPI_TECH_FIELD mineralPrice
+#include <BWAPI/TechTypeData.inl>
+#undef BWAPI_TECH_FIELD
+  };
   static const int defaultTimeCost[TechTypes::Enum::MAX] =
-  { 1200, 1500, 1800, 1200, 0, 1200, 0, 1200, 1800, 1500, 1200, 1200, 0, 1200, 0, 1500, 1500, 1200, 0, 1800, 1200, 1800, 1500, 0, 1200, 1200, 0, 1800, 0, 1800, 1800, 1500, 1800 };
+  {
+#define BWAPI_TECH_FIELD researchTime
+#include <BWAPI/TechTypeData.inl>
+#undef BWAPI_TECH_FIELD
+  };
   static const int defaultEnergyCost[TechTypes::Enum::MAX] =
-  { 0, 100, 100, 0, 50, 0, 100, 75, 150, 25, 25, 0, 0, 150, 100, 150, 0, 75, 75, 75, 100, 150, 100, 0, 50, 125, 0, 150, 0, 50, 75, 100, 0, 0, 1 };
+  {
+#define BWAPI_TECH_FIELD energyCost
+#include <BWAPI/TechTypeData.inl>
+#undef BWAPI_TECH_FIELD
+  };
+#undef BWAPI_TECH_TYPE
   
   // ACTUAL
   int oreCost[TechTypes::Enum::MAX], gasCost[TechTypes::Enum::MAX], timeCost[TechTypes::Enum::MAX], energyCost[TechTypes::Enum::MAX];
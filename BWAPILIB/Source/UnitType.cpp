@@ -4,6 +4,8 @@
 #include <algorithm>
 
 #include <BWAPI/UnitType.h>
+#include <BWAPI/UnitTypeTable.h>
+#include <BWAPI/TypeTraits.h>
 #include <BWAPI/WeaponType.h>
 #include <BWAPI/UnitSizeType.h>
 #include <BWAPI/TechType.h>
@@ -557,386 +559,390 @@ namespace BWAPI
     };
   }
 
-  // DEFAULTS
-  static const int defaultMaxHP[UnitTypes::Enum::MAX] = {
-    40, 45, 80, 125, 0, 150, 0, 60, 120, 200, 160, 150, 500, 20, 100, 40, 250, 300, 0, 300, 200, 500, 800, 400, 0, 400, 0, 1000, 
-    850, 700, 150, 0, 50, 0, 60, 25, 200, 35, 80, 400, 30, 40, 200, 120, 150, 120, 80, 25, 800, 300, 60, 400, 250, 160, 120, 300, 
-    400, 1000, 200, 200, 100, 80, 250, 25, 20, 100, 100, 40, 10, 80, 150, 200, 300, 40, 40, 60, 100, 240, 240, 80, 400, 200, 800, 
-    100, 40, 20, 600, 80, 250, 60, 60, 125, 125, 60, 60, 60, 60, 200, 100, 200, 250, 1, 700, 125, 300, 800, 1500, 500, 600, 500, 
-    750, 1000, 600, 1250, 1300, 500, 850, 750, 600, 0, 750, 0, 850, 750, 200, 350, 700, 2000, 10000, 10000, 1500, 1250, 1800, 2500, 
-    250, 850, 850, 1000, 850, 750, 600, 600, 750, 400, 400, 0, 300, 5000, 2500, 750, 250, 1500, 1500, 0, 750, 500, 300, 450, 300, 
-    250, 500, 0, 100, 450, 500, 500, 550, 600, 2000, 500, 500, 450, 200, 100000, 1500, 5000, 100000, 100000, 100000, 800, 800, 800, 
-    800, 800, 800, 800, 800, 800, 100000, 700, 2000, 100000, 100000, 100000, 100000, 100000, 100000, 100000, 100000, 100000, 800, 
-    2500, 800, 50, 100000, 100000, 100000, 100000, 100000, 50, 50, 50, 50, 50, 800, 100000, 800, 800, 800, 800, 800, 800, 800, 800, 
-    800, 800, 800, 800, 0, 0, 0, 0, 0, 0
-  };
-
-  static const int defaultMaxSP[UnitTypes::Enum::MAX] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 40, 0, 200, 20, 60, 80, 40, 350, 60, 100, 150, 150, 40, 80, 400, 800, 240, 
-    240, 300, 400, 400, 500, 80, 20, 10, 500, 300, 250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 750, 500, 300, 
-    450, 300, 250, 500, 1, 100, 450, 500, 500, 550, 600, 0, 500, 500, 450, 200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-  };
-
-  namespace UnitPrototypeFlags
+  // PROPERTY TABLE
+  namespace unitTypeData
   {
-    enum Enum : unsigned int
-    {
-      Building                = 0x00000001,
-      Addon                   = 0x00000002,
-      Flyer                   = 0x00000004,
-      Worker                  = 0x00000008,
-      Subunit                 = 0x00000010,
-      FlyingBuilding          = 0x00000020,
-      Hero                    = 0x00000040,
-      RegeneratesHP           = 0x00000080,
-      AnimatedIdle            = 0x00000100,
-      Cloakable               = 0x00000200,
-      TwoUnitsIn1Egg          = 0x00000400,
-      NeutralAccessories      = 0x00000800,
-      ResourceDepot           = 0x00001000,
-      ResourceContainer       = 0x00002000,
-      RoboticUnit             = 0x00004000,
-      Detector                = 0x00008000,
-      OrganicUnit             = 0x00010000,
-      CreepBuilding           = 0x00020000,
-      Unused                  = 0x00040000,
-      RequiresPsi             = 0x00080000,
-      Burrowable              = 0x00100000,
-      Spellcaster             = 0x00200000,
-      PermanentCloak          = 0x00400000,
-      NPCOrAccessories        = 0x00800000,
-      MorphFromOtherUnit      = 0x01000000,
-      LargeUnit               = 0x02000000,
-      HugeUnit                = 0x04000000,
-      AutoAttackAndMove       = 0x08000000,
-      Attack                  = 0x10000000, /**< Can attack */
-      Invincible              = 0x20000000,
-      Mechanical              = 0x40000000,
-      ProducesUnits           = 0x80000000 /**< It can produce units directly (making buildings doesn't count) */
-    };
+    using namespace UnitTypeFlags;
+    using namespace WeaponTypes::Enum;
 
-    static const unsigned int unitFlags[UnitTypes::Enum::MAX] =
+    // Each numeric column is expanded from UnitTypeData.inl through UnitTypeTraits, so the
+    // table and the compile-time traits cannot disagree.
+#define BWAPI_UNIT_TYPE(name, ...) UnitTypeTraits<UnitTypes::Enum::name>::BWAPI_UNIT_FIELD,
+    static const UnitTypeTable table =
     {
-      OrganicUnit | AutoAttackAndMove | Attack, 
-      Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack, 
-      AutoAttackAndMove | Attack | Mechanical, 
-      AutoAttackAndMove | Attack | Mechanical, 
-      Subunit | Attack | Invincible, 
-      LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Subunit | Attack | Invincible, 
-      Worker | OrganicUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Flyer | Cloakable | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Flyer | AnimatedIdle | Detector | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Hero | OrganicUnit | AutoAttackAndMove | Attack, 
-      Flyer | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Flyer | Spellcaster | HugeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      AutoAttackAndMove | Attack, 
-      Flyer | AutoAttackAndMove | Attack | Invincible, 
-      OrganicUnit | AutoAttackAndMove | Attack, 
-      Hero | Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack, 
-      Hero | AutoAttackAndMove | Attack | Mechanical, 
-      Subunit | Attack | Invincible, 
-      Hero | AutoAttackAndMove | Attack | Mechanical, 
-      Hero | OrganicUnit | AutoAttackAndMove | Attack, 
-      Flyer | Hero | Cloakable | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Flyer | Hero | AnimatedIdle | Detector | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Hero | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Subunit | Attack | Invincible, 
-      Hero | LargeUnit | Mechanical, 
-      Subunit | Attack | Invincible, 
-      Flyer | Hero | Spellcaster | HugeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Flyer | Hero | Spellcaster | HugeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Flyer | Hero | Spellcaster | HugeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      LargeUnit | Mechanical, 
-      Subunit | Attack | Invincible, 
-      OrganicUnit | AutoAttackAndMove | Attack, 
-      Flyer | Detector | AutoAttackAndMove | Attack, 
-      OrganicUnit | Spellcaster | AutoAttackAndMove | Attack, 
-      RegeneratesHP | OrganicUnit | AutoAttackAndMove | Attack, 
-      OrganicUnit, 
-      RegeneratesHP | TwoUnitsIn1Egg | OrganicUnit | Burrowable | AutoAttackAndMove | Attack, 
-      RegeneratesHP | OrganicUnit | Burrowable | AutoAttackAndMove | Attack, 
-      RegeneratesHP | OrganicUnit | HugeUnit | AutoAttackAndMove | Attack, 
-      RegeneratesHP | OrganicUnit | AutoAttackAndMove | Attack, 
-      Worker | RegeneratesHP | OrganicUnit | Burrowable | AutoAttackAndMove | Attack, 
-      Flyer | RegeneratesHP | Detector | OrganicUnit | LargeUnit | AutoAttackAndMove | Attack, 
-      Flyer | RegeneratesHP | OrganicUnit | LargeUnit | AutoAttackAndMove | Attack, 
-      Flyer | RegeneratesHP | OrganicUnit | MorphFromOtherUnit | HugeUnit | AutoAttackAndMove | Attack, 
-      Flyer | RegeneratesHP | OrganicUnit | Spellcaster | LargeUnit | AutoAttackAndMove | Attack, 
-      RegeneratesHP | OrganicUnit | Burrowable | Spellcaster | LargeUnit | AutoAttackAndMove | Attack, 
-      Flyer | RegeneratesHP | TwoUnitsIn1Egg | OrganicUnit | AutoAttackAndMove | Attack, 
-      Hero | RegeneratesHP | OrganicUnit | HugeUnit | AutoAttackAndMove | Attack, 
-      Flyer | Hero | RegeneratesHP | OrganicUnit | Spellcaster | LargeUnit | AutoAttackAndMove | Attack, 
-      RegeneratesHP | OrganicUnit | Burrowable | AutoAttackAndMove | Attack, 
-      Hero | RegeneratesHP | Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack, 
-      Hero | RegeneratesHP | OrganicUnit | Burrowable | Spellcaster | LargeUnit | AutoAttackAndMove | Attack, 
-      Hero | RegeneratesHP | OrganicUnit | Burrowable | AutoAttackAndMove | Attack, 
-      Hero | RegeneratesHP | TwoUnitsIn1Egg | OrganicUnit | Burrowable | AutoAttackAndMove | Attack, 
-      Flyer | Hero | RegeneratesHP | OrganicUnit | LargeUnit | AutoAttackAndMove | Attack, 
-      Flyer | Hero | RegeneratesHP | OrganicUnit | MorphFromOtherUnit | HugeUnit | AutoAttackAndMove | Attack, 
-      Flyer | Hero | RegeneratesHP | Detector | OrganicUnit | LargeUnit | AutoAttackAndMove | Attack, 
-      Flyer | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Flyer | OrganicUnit, 
-      Flyer | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      OrganicUnit | PermanentCloak | AutoAttackAndMove | Attack, 
-      Flyer | RegeneratesHP | OrganicUnit | MorphFromOtherUnit | HugeUnit | AutoAttackAndMove | Attack, 
-      AnimatedIdle | Spellcaster | HugeUnit | AutoAttackAndMove | Attack, 
-      Worker | RoboticUnit | AutoAttackAndMove | Attack | Mechanical, 
-      OrganicUnit | AutoAttackAndMove | Attack, 
-      LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      OrganicUnit | Spellcaster | AutoAttackAndMove | Attack, 
-      AnimatedIdle | HugeUnit | AutoAttackAndMove | Attack, 
-      Flyer | RoboticUnit | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Flyer | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Flyer | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Flyer | HugeUnit | AutoAttackAndMove | Attack | Mechanical | ProducesUnits, 
-      Flyer | AutoAttackAndMove | Attack | Mechanical, 
-      OrganicUnit | PermanentCloak | AutoAttackAndMove | Attack, 
-      Hero | OrganicUnit | PermanentCloak | AutoAttackAndMove | Attack, 
-      Hero | AnimatedIdle | HugeUnit | AutoAttackAndMove | Attack, 
-      Hero | OrganicUnit | AutoAttackAndMove | Attack, 
-      Hero | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Hero | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack, 
-      Flyer | Hero | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Hero | RoboticUnit | HugeUnit | AutoAttackAndMove | Attack | Mechanical | ProducesUnits, 
-      Flyer | Hero | HugeUnit | AutoAttackAndMove | Attack | Mechanical | ProducesUnits, 
-      RoboticUnit | HugeUnit | AutoAttackAndMove | Attack | Mechanical | ProducesUnits, 
-      Flyer | RoboticUnit | Detector | PermanentCloak | AutoAttackAndMove | Attack | Mechanical, 
-      AutoAttackAndMove | Attack | Invincible | Mechanical, 
-      Flyer | Hero | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Hero | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack, 
-      Flyer | Hero | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      OrganicUnit | AutoAttackAndMove | Attack, 
-      OrganicUnit | AutoAttackAndMove | Attack, 
-      0,
-      0,
-      OrganicUnit | AutoAttackAndMove | Attack, 
-      Flyer | OrganicUnit | AutoAttackAndMove | Attack, 
-      OrganicUnit | AutoAttackAndMove | Attack, 
-      OrganicUnit | AutoAttackAndMove | Attack, 
-      OrganicUnit, 
-      Flyer | Hero | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      Hero | Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack, 
-      Hero | Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack, 
-      Flyer, 
-      Flyer | Hero | Spellcaster | HugeUnit | AutoAttackAndMove | Attack | Mechanical, 
-      RegeneratesHP | OrganicUnit | Burrowable | AutoAttackAndMove | Attack, 
-      Hero | RegeneratesHP | Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack, 
-      Invincible, 
-      Building | FlyingBuilding | ResourceDepot | HugeUnit | Mechanical | ProducesUnits, 
-      Building | Addon | Spellcaster | HugeUnit | Mechanical, 
-      Building | Addon | HugeUnit | Mechanical, 
-      Building | HugeUnit | Mechanical, 
-      Building | ResourceContainer | HugeUnit | Mechanical, 
-      Building | FlyingBuilding | HugeUnit | Mechanical | ProducesUnits, 
-      Building | HugeUnit | Mechanical, 
-      Building | FlyingBuilding | HugeUnit | Mechanical | ProducesUnits, 
-      Building | FlyingBuilding | HugeUnit | Mechanical | ProducesUnits, 
-      Building | Addon | HugeUnit | Mechanical, 
-      Building | FlyingBuilding | HugeUnit | Mechanical, 
-      Building | Addon | HugeUnit | Mechanical, 
-      Building | Addon | HugeUnit | Mechanical, 
-      Building | HugeUnit, 
-      Building | Addon | HugeUnit | Mechanical, 
-      Building | Addon | HugeUnit | Mechanical, 
-      Building | FlyingBuilding | HugeUnit | Mechanical, 
-      Building | HugeUnit | Mechanical, 
-      Building | AnimatedIdle | Detector | HugeUnit | Attack | Mechanical, 
-      Building | HugeUnit | Mechanical, 
-      Building | HugeUnit | Mechanical, 
-      Building | HugeUnit | Mechanical, 
-      NeutralAccessories | Invincible, 
-      NeutralAccessories | Invincible, 
-      Building | FlyingBuilding | RegeneratesHP | OrganicUnit | HugeUnit | ProducesUnits, 
-      Building | RegeneratesHP | ResourceDepot | OrganicUnit | MorphFromOtherUnit | HugeUnit | ProducesUnits, 
-      Building | RegeneratesHP | ResourceDepot | OrganicUnit | MorphFromOtherUnit | HugeUnit | ProducesUnits, 
-      Building | RegeneratesHP | ResourceDepot | OrganicUnit | MorphFromOtherUnit | HugeUnit | ProducesUnits, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit | Attack, 
-      Building | RegeneratesHP | ResourceContainer | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit | Attack, 
-      Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | ResourceContainer | OrganicUnit | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Building | RegeneratesHP | MorphFromOtherUnit | HugeUnit, 
-      Building | ResourceDepot | HugeUnit | Mechanical | ProducesUnits, 
-      Building | RequiresPsi | HugeUnit | Mechanical | ProducesUnits, 
-      Building | HugeUnit | Mechanical, 
-      Building | ResourceContainer | HugeUnit | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical | ProducesUnits, 
-      Building | RequiresPsi | HugeUnit | Mechanical, 
-      Building | Detector | RequiresPsi | HugeUnit | Attack | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical | ProducesUnits, 
-      Building | HugeUnit | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical, 
-      Building | RequiresPsi | HugeUnit | Mechanical, 
-      Building | RequiresPsi | Spellcaster | HugeUnit | Mechanical, 
-      Building | HugeUnit | Invincible, 
-      Building | HugeUnit, 
-      Building | HugeUnit, 
-      Building | ResourceContainer | HugeUnit | Invincible, 
-      Building | ResourceContainer | HugeUnit | Invincible, 
-      Building | ResourceContainer | HugeUnit | Invincible, 
-      Building | ResourceContainer | HugeUnit | Invincible, 
-      Building | ResourceContainer | HugeUnit | Invincible, 
-      Building | HugeUnit | Mechanical, 
-      Building | HugeUnit | Mechanical, 
-      Building | HugeUnit | Mechanical, 
-      Building | HugeUnit | Mechanical, 
-      Building | HugeUnit, 
-      Building | HugeUnit, 
-      Building | HugeUnit, 
-      Building | ResourceContainer | HugeUnit | Invincible, 
-      Building | HugeUnit | Mechanical, 
-      Building | HugeUnit | Mechanical, 
-      Building | Invincible, 
-      Building | Invincible, 
-      Building | Invincible, 
-      Building | Invincible, 
-      Building | Invincible, 
-      Building | Invincible, 
-      Building | Invincible, 
-      Building | Invincible, 
-      Building | Invincible, 
-      Building | HugeUnit | Mechanical, 
-      Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit, 
-      Invincible, 
-      Detector | HugeUnit | Attack | Mechanical, 
-      Invincible, 
-      Invincible, 
-      Invincible, 
-      Invincible, 
-      Invincible, 
-      Detector | HugeUnit | Attack | Mechanical, 
-      Detector | HugeUnit | Mechanical, 
-      Detector | HugeUnit | Mechanical, 
-      Detector | HugeUnit | Mechanical, 
-      Detector | HugeUnit | Mechanical, 
-      Building | ResourceDepot, 
-      NeutralAccessories | Invincible, 
-      NeutralAccessories | NPCOrAccessories | Invincible, 
-      NeutralAccessories | NPCOrAccessories | Invincible, 
-      NeutralAccessories | NPCOrAccessories | Invincible, 
-      NeutralAccessories | NPCOrAccessories | Invincible, 
-      NeutralAccessories | NPCOrAccessories, 
-      NeutralAccessories | NPCOrAccessories, 
-      NeutralAccessories | NPCOrAccessories, 
-      NeutralAccessories | NPCOrAccessories, 
-      NeutralAccessories | NPCOrAccessories, 
-      NeutralAccessories | NPCOrAccessories, 
-      NeutralAccessories | NPCOrAccessories, 
-      NeutralAccessories | NPCOrAccessories,
-      0,0,0,0,0,0
+      // flags
+      {
+        OrganicUnit | AutoAttackAndMove | Attack,
+        Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack,
+        AutoAttackAndMove | Attack | Mechanical,
+        AutoAttackAndMove | Attack | Mechanical,
+        Subunit | Attack | Invincible,
+        LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Subunit | Attack | Invincible,
+        Worker | OrganicUnit | AutoAttackAndMove | Attack | Mechanical,
+        Flyer | Cloakable | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Flyer | AnimatedIdle | Detector | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Hero | OrganicUnit | AutoAttackAndMove | Attack,
+        Flyer | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Flyer | Spellcaster | HugeUnit | AutoAttackAndMove | Attack | Mechanical,
+        AutoAttackAndMove | Attack,
+        Flyer | AutoAttackAndMove | Attack | Invincible,
+        OrganicUnit | AutoAttackAndMove | Attack,
+        Hero | Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack,
+        Hero | AutoAttackAndMove | Attack | Mechanical,
+        Subunit | Attack | Invincible,
+        Hero | AutoAttackAndMove | Attack | Mechanical,
+        Hero | OrganicUnit | AutoAttackAndMove | Attack,
+        Flyer | Hero | Cloakable | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Flyer | Hero | AnimatedIdle | Detector | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Hero | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Subunit | Attack | Invincible,
+        Hero | LargeUnit | Mechanical,
+        Subunit | Attack | Invincible,
+        Flyer | Hero | Spellcaster | HugeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Flyer | Hero | Spellcaster | HugeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Flyer | Hero | Spellcaster | HugeUnit | AutoAttackAndMove | Attack | Mechanical,
+        LargeUnit | Mechanical,
+        Subunit | Attack | Invincible,
+        OrganicUnit | AutoAttackAndMove | Attack,
+        Flyer | Detector | AutoAttackAndMove | Attack,
+        OrganicUnit | Spellcaster | AutoAttackAndMove | Attack,
+        RegeneratesHP | OrganicUnit | AutoAttackAndMove | Attack,
+        OrganicUnit,
+        RegeneratesHP | TwoUnitsIn1Egg | OrganicUnit | Burrowable | AutoAttackAndMove | Attack,
+        RegeneratesHP | OrganicUnit | Burrowable | AutoAttackAndMove | Attack,
+        RegeneratesHP | OrganicUnit | HugeUnit | AutoAttackAndMove | Attack,
+        RegeneratesHP | OrganicUnit | AutoAttackAndMove | Attack,
+        Worker | RegeneratesHP | OrganicUnit | Burrowable | AutoAttackAndMove | Attack,
+        Flyer | RegeneratesHP | Detector | OrganicUnit | LargeUnit | AutoAttackAndMove | Attack,
+        Flyer | RegeneratesHP | OrganicUnit | LargeUnit | AutoAttackAndMove | Attack,
+        Flyer | RegeneratesHP | OrganicUnit | MorphFromOtherUnit | HugeUnit | AutoAttackAndMove | Attack,
+        Flyer | RegeneratesHP | OrganicUnit | Spellcaster | LargeUnit | AutoAttackAndMove | Attack,
+        RegeneratesHP | OrganicUnit | Burrowable | Spellcaster | LargeUnit | AutoAttackAndMove | Attack,
+        Flyer | RegeneratesHP | TwoUnitsIn1Egg | OrganicUnit | AutoAttackAndMove | Attack,
+        Hero | RegeneratesHP | OrganicUnit | HugeUnit | AutoAttackAndMove | Attack,
+        Flyer | Hero | RegeneratesHP | OrganicUnit | Spellcaster | LargeUnit | AutoAttackAndMove | Attack,
+        RegeneratesHP | OrganicUnit | Burrowable | AutoAttackAndMove | Attack,
+        Hero | RegeneratesHP | Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack,
+        Hero | RegeneratesHP | OrganicUnit | Burrowable | Spellcaster | LargeUnit | AutoAttackAndMove | Attack,
+        Hero | RegeneratesHP | OrganicUnit | Burrowable | AutoAttackAndMove | Attack,
+        Hero | RegeneratesHP | TwoUnitsIn1Egg | OrganicUnit | Burrowable | AutoAttackAndMove | Attack,
+        Flyer | Hero | RegeneratesHP | OrganicUnit | LargeUnit | AutoAttackAndMove | Attack,
+        Flyer | Hero | RegeneratesHP | OrganicUnit | MorphFromOtherUnit | HugeUnit | AutoAttackAndMove | Attack,
+        Flyer | Hero | RegeneratesHP | Detector | OrganicUnit | LargeUnit | AutoAttackAndMove | Attack,
+        Flyer | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Flyer | OrganicUnit,
+        Flyer | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        OrganicUnit | PermanentCloak | AutoAttackAndMove | Attack,
+        Flyer | RegeneratesHP | OrganicUnit | MorphFromOtherUnit | HugeUnit | AutoAttackAndMove | Attack,
+        AnimatedIdle | Spellcaster | HugeUnit | AutoAttackAndMove | Attack,
+        Worker | RoboticUnit | AutoAttackAndMove | Attack | Mechanical,
+        OrganicUnit | AutoAttackAndMove | Attack,
+        LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        OrganicUnit | Spellcaster | AutoAttackAndMove | Attack,
+        AnimatedIdle | HugeUnit | AutoAttackAndMove | Attack,
+        Flyer | RoboticUnit | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Flyer | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Flyer | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Flyer | HugeUnit | AutoAttackAndMove | Attack | Mechanical | ProducesUnits,
+        Flyer | AutoAttackAndMove | Attack | Mechanical,
+        OrganicUnit | PermanentCloak | AutoAttackAndMove | Attack,
+        Hero | OrganicUnit | PermanentCloak | AutoAttackAndMove | Attack,
+        Hero | AnimatedIdle | HugeUnit | AutoAttackAndMove | Attack,
+        Hero | OrganicUnit | AutoAttackAndMove | Attack,
+        Hero | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Hero | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack,
+        Flyer | Hero | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Hero | RoboticUnit | HugeUnit | AutoAttackAndMove | Attack | Mechanical | ProducesUnits,
+        Flyer | Hero | HugeUnit | AutoAttackAndMove | Attack | Mechanical | ProducesUnits,
+        RoboticUnit | HugeUnit | AutoAttackAndMove | Attack | Mechanical | ProducesUnits,
+        Flyer | RoboticUnit | Detector | PermanentCloak | AutoAttackAndMove | Attack | Mechanical,
+        AutoAttackAndMove | Attack | Invincible | Mechanical,
+        Flyer | Hero | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Hero | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack,
+        Flyer | Hero | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        OrganicUnit | AutoAttackAndMove | Attack,
+        OrganicUnit | AutoAttackAndMove | Attack,
+        0,
+        0,
+        OrganicUnit | AutoAttackAndMove | Attack,
+        Flyer | OrganicUnit | AutoAttackAndMove | Attack,
+        OrganicUnit | AutoAttackAndMove | Attack,
+        OrganicUnit | AutoAttackAndMove | Attack,
+        OrganicUnit,
+        Flyer | Hero | Spellcaster | LargeUnit | AutoAttackAndMove | Attack | Mechanical,
+        Hero | Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack,
+        Hero | Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack,
+        Flyer,
+        Flyer | Hero | Spellcaster | HugeUnit | AutoAttackAndMove | Attack | Mechanical,
+        RegeneratesHP | OrganicUnit | Burrowable | AutoAttackAndMove | Attack,
+        Hero | RegeneratesHP | Cloakable | OrganicUnit | Spellcaster | AutoAttackAndMove | Attack,
+        Invincible,
+        Building | FlyingBuilding | ResourceDepot | HugeUnit | Mechanical | ProducesUnits,
+        Building | Addon | Spellcaster | HugeUnit | Mechanical,
+        Building | Addon | HugeUnit | Mechanical,
+        Building | HugeUnit | Mechanical,
+        Building | ResourceContainer | HugeUnit | Mechanical,
+        Building | FlyingBuilding | HugeUnit | Mechanical | ProducesUnits,
+        Building | HugeUnit | Mechanical,
+        Building | FlyingBuilding | HugeUnit | Mechanical | ProducesUnits,
+        Building | FlyingBuilding | HugeUnit | Mechanical | ProducesUnits,
+        Building | Addon | HugeUnit | Mechanical,
+        Building | FlyingBuilding | HugeUnit | Mechanical,
+        Building | Addon | HugeUnit | Mechanical,
+        Building | Addon | HugeUnit | Mechanical,
+        Building | HugeUnit,
+        Building | Addon | HugeUnit | Mechanical,
+        Building | Addon | HugeUnit | Mechanical,
+        Building | FlyingBuilding | HugeUnit | Mechanical,
+        Building | HugeUnit | Mechanical,
+        Building | AnimatedIdle | Detector | HugeUnit | Attack | Mechanical,
+        Building | HugeUnit | Mechanical,
+        Building | HugeUnit | Mechanical,
+        Building | HugeUnit | Mechanical,
+        NeutralAccessories | Invincible,
+        NeutralAccessories | Invincible,
+        Building | FlyingBuilding | RegeneratesHP | OrganicUnit | HugeUnit | ProducesUnits,
+        Building | RegeneratesHP | ResourceDepot | OrganicUnit | MorphFromOtherUnit | HugeUnit | ProducesUnits,
+        Building | RegeneratesHP | ResourceDepot | OrganicUnit | MorphFromOtherUnit | HugeUnit | ProducesUnits,
+        Building | RegeneratesHP | ResourceDepot | OrganicUnit | MorphFromOtherUnit | HugeUnit | ProducesUnits,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit | Attack,
+        Building | RegeneratesHP | ResourceContainer | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit | Attack,
+        Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | ResourceContainer | OrganicUnit | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Building | RegeneratesHP | MorphFromOtherUnit | HugeUnit,
+        Building | ResourceDepot | HugeUnit | Mechanical | ProducesUnits,
+        Building | RequiresPsi | HugeUnit | Mechanical | ProducesUnits,
+        Building | HugeUnit | Mechanical,
+        Building | ResourceContainer | HugeUnit | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical | ProducesUnits,
+        Building | RequiresPsi | HugeUnit | Mechanical,
+        Building | Detector | RequiresPsi | HugeUnit | Attack | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical | ProducesUnits,
+        Building | HugeUnit | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical,
+        Building | RequiresPsi | HugeUnit | Mechanical,
+        Building | RequiresPsi | Spellcaster | HugeUnit | Mechanical,
+        Building | HugeUnit | Invincible,
+        Building | HugeUnit,
+        Building | HugeUnit,
+        Building | ResourceContainer | HugeUnit | Invincible,
+        Building | ResourceContainer | HugeUnit | Invincible,
+        Building | ResourceContainer | HugeUnit | Invincible,
+        Building | ResourceContainer | HugeUnit | Invincible,
+        Building | ResourceContainer | HugeUnit | Invincible,
+        Building | HugeUnit | Mechanical,
+        Building | HugeUnit | Mechanical,
+        Building | HugeUnit | Mechanical,
+        Building | HugeUnit | Mechanical,
+        Building | HugeUnit,
+        Building | HugeUnit,
+        Building | HugeUnit,
+        Building | ResourceContainer | HugeUnit | Invincible,
+        Building | HugeUnit | Mechanical,
+        Building | HugeUnit | Mechanical,
+        Building | Invincible,
+        Building | Invincible,
+        Building | Invincible,
+        Building | Invincible,
+        Building | Invincible,
+        Building | Invincible,
+        Building | Invincible,
+        Building | Invincible,
+        Building | Invincible,
+        Building | HugeUnit | Mechanical,
+        Building | RegeneratesHP | Detector | OrganicUnit | CreepBuilding | MorphFromOtherUnit | HugeUnit,
+        Invincible,
+        Detector | HugeUnit | Attack | Mechanical,
+        Invincible,
+        Invincible,
+        Invincible,
+        Invincible,
+        Invincible,
+        Detector | HugeUnit | Attack | Mechanical,
+        Detector | HugeUnit | Mechanical,
+        Detector | HugeUnit | Mechanical,
+        Detector | HugeUnit | Mechanical,
+        Detector | HugeUnit | Mechanical,
+        Building | ResourceDepot,
+        NeutralAccessories | Invincible,
+        NeutralAccessories | NPCOrAccessories | Invincible,
+        NeutralAccessories | NPCOrAccessories | Invincible,
+        NeutralAccessories | NPCOrAccessories | Invincible,
+        NeutralAccessories | NPCOrAccessories | Invincible,
+        NeutralAccessories | NPCOrAccessories,
+        NeutralAccessories | NPCOrAccessories,
+        NeutralAccessories | NPCOrAccessories,
+        NeutralAccessories | NPCOrAccessories,
+        NeutralAccessories | NPCOrAccessories,
+        NeutralAccessories | NPCOrAccessories,
+        NeutralAccessories | NPCOrAccessories,
+        NeutralAccessories | NPCOrAccessories,
+        0,0,0,0,0,0
+      },
+      // maxHitPoints
+      {
+#define BWAPI_UNIT_FIELD maxHitPoints
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // maxShields
+      {
+#define BWAPI_UNIT_FIELD maxShields
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // mineralPrice
+      {
+#define BWAPI_UNIT_FIELD mineralPrice
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // gasPrice
+      {
+#define BWAPI_UNIT_FIELD gasPrice
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // buildTime
+      {
+#define BWAPI_UNIT_FIELD buildTime
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // dimensionLeft
+      {
+#define BWAPI_UNIT_FIELD dimensionLeft
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // dimensionUp
+      {
+#define BWAPI_UNIT_FIELD dimensionUp
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // dimensionRight
+      {
+#define BWAPI_UNIT_FIELD dimensionRight
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // dimensionDown
+      {
+#define BWAPI_UNIT_FIELD dimensionDown
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // armor
+      {
+#define BWAPI_UNIT_FIELD armor
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // supplyRequired
+      {
+#define BWAPI_UNIT_FIELD supplyRequired
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // supplyProvided
+      {
+#define BWAPI_UNIT_FIELD supplyProvided
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // spaceRequired
+      {
+#define BWAPI_UNIT_FIELD spaceRequired
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // spaceProvided
+      {
+#define BWAPI_UNIT_FIELD spaceProvided
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // tileWidth
+      {
+#define BWAPI_UNIT_FIELD tileWidth
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // tileHeight
+      {
+#define BWAPI_UNIT_FIELD tileHeight
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // seekRangeTiles
+      {
+#define BWAPI_UNIT_FIELD seekRangeTiles
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // sightRangeTiles
+      {
+#define BWAPI_UNIT_FIELD sightRangeTiles
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // groundWeapon
+      {
+#define BWAPI_UNIT_FIELD groundWeapon
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // airWeapon
+      {
+#define BWAPI_UNIT_FIELD airWeapon
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // maxGroundHits
+      {
+#define BWAPI_UNIT_FIELD maxGroundHits
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      },
+      // maxAirHits
+      {
+#define BWAPI_UNIT_FIELD maxAirHits
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_FIELD
+      }
     };
+#undef BWAPI_UNIT_TYPE
   }
-
-  static const int defaultArmorAmount[UnitTypes::Enum::MAX] = {
-    0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 3, 1, 3, 0, 0, 0, 3, 3, 0, 3, 3, 4, 4, 3, 0, 3, 0, 4, 4, 4, 1, 0, 1, 0, 1, 10, 10, 0, 
-    0, 1, 0, 0, 0, 0, 2, 0, 1, 0, 4, 3, 0, 2, 3, 2, 3, 3, 4, 4, 2, 0, 1, 1, 2, 1, 0, 1, 1, 0, 0, 1, 0, 1, 4, 0, 0, 0, 3, 
-    2, 3, 2, 3, 3, 4, 0, 0, 0, 3, 2, 3, 0, 0, 1, 1, 0, 0, 0, 0, 10, 0, 2, 3, 0, 4, 1, 3, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 
-    1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-  };
-
-  static const int defaultOreCost[UnitTypes::Enum::MAX] = {
-    50, 25, 75, 100, 1, 150, 1, 50, 150, 100, 100, 100, 400, 1, 200, 0, 50, 200, 1, 150, 50, 400, 50, 300, 1, 300, 1, 800, 
-    800, 800, 150, 1, 50, 0, 50, 1, 1, 50, 75, 200, 1, 50, 100, 100, 50, 100, 50, 25, 400, 200, 100, 200, 50, 150, 100, 200, 
-    100, 200, 250, 1, 150, 125, 150, 0, 50, 100, 125, 50, 0, 200, 275, 100, 350, 25, 150, 100, 0, 200, 300, 100, 600, 400, 
-    700, 200, 25, 15, 50, 100, 600, 1, 1, 100, 100, 1, 1, 1, 1, 1, 150, 200, 200, 0, 800, 50, 200, 250, 400, 50, 100, 100, 
-    100, 150, 150, 200, 150, 50, 100, 50, 50, 1, 50, 1, 125, 100, 75, 100, 800, 200, 1, 1, 1, 300, 150, 200, 150, 100, 100, 
-    100, 150, 75, 150, 200, 200, 75, 50, 1, 50, 1, 1, 50, 0, 0, 0, 1, 400, 200, 100, 100, 1, 50, 150, 1, 150, 150, 200, 150, 
-    150, 150, 150, 300, 200, 150, 100, 250, 250, 1500, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 600, 1000, 250, 50, 100, 250, 
-    50, 100, 250, 50, 100, 200, 1000, 250, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0
-  };
-
-  static const int defaultGasCost[UnitTypes::Enum::MAX] = {
-    0, 75, 0, 50, 1, 100, 1, 0, 100, 225, 50, 100, 300, 0, 200, 0, 150, 100, 1, 0, 0, 200, 600, 200, 1, 200, 1, 600, 600, 600, 100, 
-    1, 25, 0, 25, 1, 1, 0, 25, 200, 1, 0, 0, 100, 100, 100, 150, 75, 400, 300, 50, 300, 200, 50, 0, 200, 200, 0, 125, 1, 100, 100, 
-    50, 0, 0, 0, 50, 150, 0, 0, 125, 350, 250, 0, 150, 300, 0, 0, 100, 300, 300, 200, 600, 100, 75, 0, 1000, 300, 300, 1, 1, 100, 
-    100, 1, 1, 1, 1, 1, 100, 75, 75, 0, 600, 100, 75, 250, 0, 50, 100, 0, 0, 0, 0, 100, 100, 50, 150, 50, 50, 1, 50, 1, 0, 50, 0, 0, 
-    600, 0, 1, 1, 1, 0, 100, 150, 0, 50, 100, 150, 100, 0, 200, 150, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 200, 0, 0, 1, 100, 0, 1, 
-    0, 100, 0, 200, 0, 150, 0, 200, 150, 100, 0, 0, 0, 500, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 200, 400, 0, 50, 100, 0, 50, 100, 
-    0, 50, 100, 50, 500, 200, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0
-  };
-
-  static const int defaultTimeCost[UnitTypes::Enum::MAX] = {
-    360, 750, 450, 600, 1, 750, 1, 300, 900, 1200, 720, 750, 2000, 1, 1500, 1, 1500, 1200, 1, 900, 1, 1800, 2400, 1500, 1, 1500, 1, 
-    4800, 2400, 4800, 750, 1, 360, 1, 450, 1, 1, 420, 420, 900, 1, 300, 600, 600, 600, 750, 750, 450, 1800, 1500, 600, 1500, 1500, 
-    780, 840, 1200, 1200, 1200, 750, 1, 600, 750, 600, 300, 300, 600, 750, 750, 300, 900, 1200, 2400, 2100, 300, 750, 1500, 600, 
-    1200, 1500, 1500, 2400, 1800, 4200, 1050, 600, 105, 4800, 1500, 2400, 1, 1, 600, 600, 1, 1, 1, 1, 1, 750, 1500, 1500, 1, 4800, 
-    600, 1500, 2400, 1800, 600, 1200, 600, 600, 1200, 1200, 1200, 1050, 600, 900, 600, 600, 1, 600, 1, 900, 1200, 450, 450, 4800, 
-    900, 1, 1, 1800, 1800, 1500, 1800, 600, 600, 900, 1800, 900, 600, 1200, 1800, 1200, 300, 300, 1, 300, 1, 1, 600, 0, 0, 0, 1, 
-    1800, 1200, 450, 600, 1, 450, 900, 1, 750, 900, 900, 900, 600, 1050, 1, 900, 900, 450, 450, 1, 1, 4800, 1, 1, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 2400, 4800, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2400, 2400, 2400, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 
-    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0
-  };
+  const UnitTypeTable &unitTypeTable = unitTypeData::table;
 
   // ACTUAL
   int maxHP[UnitTypes::Enum::MAX], maxSP[UnitTypes::Enum::MAX], armorAmount[UnitTypes::Enum::MAX],
       unitOreCost[UnitTypes::Enum::MAX], unitGasCost[UnitTypes::Enum::MAX], unitTimeCost[UnitTypes::Enum::MAX];
 
-  static const int unitSupplyProvided[UnitTypes::Enum::MAX] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-  };
-
-  static const int unitSupplyRequired[UnitTypes::Enum::MAX] = {
-    2, 2, 4, 4, 0, 4, 0, 2, 4, 4, 0, 4, 12, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 2, 0, 2, 0, 0, 1, 2, 8, 0, 2, 
-    0, 4, 4, 4, 4, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 6, 0, 4, 4, 4, 8, 2, 4, 4, 4, 8, 4, 6, 8, 12, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 8, 2, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-  };
-
-  static const int unitSpaceRequired[UnitTypes::Enum::MAX] = {
-    1, 1, 2, 2, 255, 4, 255, 1, 255, 255, 1, 255, 255, 255, 255, 1, 1, 2, 255, 2, 1, 255, 255, 4, 255, 255, 255, 255, 255, 
-    255, 255, 255, 1, 255, 1, 255, 255, 1, 2, 4, 1, 1, 255, 255, 255, 255, 2, 255, 4, 255, 1, 1, 2, 2, 1, 255, 255, 255, 255, 
-    255, 255, 2, 255, 4, 1, 2, 4, 2, 4, 255, 255, 255, 255, 255, 2, 2, 4, 2, 4, 2, 255, 4, 255, 4, 255, 255, 255, 2, 255, 255, 
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 1, 1, 255, 255, 4, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0
-  };
-
-  static const int unitSpaceProvided[UnitTypes::Enum::MAX] = {
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-  };
-
   static const int unitBuildScore[UnitTypes::Enum::MAX] = {
     50, 175, 75, 200, 0, 350, 0, 50, 400, 625, 0, 300, 1200, 0, 800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 0, 125, 
     0, 0, 25, 125, 650, 0, 50, 100, 300, 550, 400, 225, 100, 0, 0, 200, 0, 0, 0, 0, 0, 0, 0, 400, 0, 350, 325, 550, 650, 50, 100, 250, 
@@ -959,38 +965,6 @@ namespace BWAPI
     0, 0, 0, 0, 0, 0
   };
 
-  static const struct { int tileWidth, tileHeight, left, up, right, down; }
-  unitDimensions[UnitTypes::Enum::MAX] = {
-    {1,1,8,9,8,10}, {1,1,7,10,7,11}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,1,1,1,1}, {1,1,16,16,15,15}, {1,1,1,1,1,1}, {1,1,11,11,11,11}, {1,1,19,15,18,14}, 
-    {2,2,32,33,32,16}, {1,1,11,7,11,14}, {2,2,24,16,24,20}, {2,2,37,29,37,29}, {1,1,7,7,7,7}, {1,1,7,14,7,14}, {1,1,8,9,8,10}, {1,1,7,10,7,11}, {1,1,16,16,15,15}, 
-    {1,1,1,1,1,1}, {1,1,16,16,15,15}, {1,1,8,9,8,10}, {1,1,19,15,18,14}, {2,2,32,33,32,16}, {1,1,16,16,15,15}, {1,1,1,1,1,1}, {1,1,16,16,15,15}, {1,1,1,1,1,1}, 
-    {2,2,37,29,37,29}, {2,2,37,29,37,29}, {2,2,37,29,37,29}, {1,1,16,16,15,15}, {1,1,1,1,1,1}, {1,1,11,7,11,14}, {1,1,13,13,13,17}, {1,1,8,9,8,10}, {1,1,8,8,7,7}, 
-    {1,1,16,16,15,15}, {1,1,8,4,7,11}, {1,1,10,10,10,12}, {2,2,19,16,18,15}, {1,1,9,9,9,9}, {1,1,11,11,11,11}, {2,2,25,25,24,24}, {2,2,22,22,21,21}, {2,2,22,22,21,21}, 
-    {2,2,24,24,23,23}, {1,1,13,12,13,12}, {1,1,12,12,11,11}, {2,2,19,16,18,15}, {2,2,24,24,23,23}, {1,1,8,9,8,10}, {1,1,7,10,7,11}, {1,1,13,12,13,12}, {1,1,10,10,10,12}, 
-    {1,1,8,4,7,11}, {2,2,22,22,21,21}, {2,2,22,22,21,21}, {2,2,25,25,24,24}, {2,2,24,16,24,20}, {1,1,16,16,15,15}, {1,1,18,16,17,15}, {1,1,12,6,11,19}, {2,2,22,22,21,21}, 
-    {1,1,16,16,15,15}, {1,1,11,11,11,11}, {1,1,11,5,11,13}, {1,1,15,15,16,16}, {1,1,12,10,11,13}, {1,1,16,16,15,15}, {2,1,20,16,19,15}, {2,1,18,16,17,15}, {2,2,22,22,21,21}, 
-    {2,2,32,32,31,31}, {1,1,8,8,7,7}, {1,1,12,6,11,19}, {1,1,12,6,11,19}, {1,1,16,16,15,15}, {1,1,11,5,11,13}, {1,1,15,15,16,16}, {1,1,12,10,11,13}, {2,1,18,16,17,15}, 
-    {1,1,16,16,15,15}, {2,2,32,32,31,31}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,2,2,2,2}, {2,2,22,22,21,21}, {1,1,12,10,11,13}, {2,1,18,16,17,15}, {1,1,16,16,15,15}, 
-    {1,1,16,16,15,15}, {1,1,15,15,16,16}, {1,1,15,15,16,16}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, 
-    {1,1,18,16,17,15}, {1,1,7,10,7,11}, {1,1,7,10,7,11}, {1,1,13,13,13,17}, {2,2,37,29,37,29}, {1,1,15,15,16,16}, {1,1,7,10,7,11}, {4,3,60,40,59,39}, {4,3,58,41,58,41}, 
-    {2,2,37,16,31,25}, {2,2,37,16,31,25}, {3,2,38,22,38,26}, {4,2,56,32,56,31}, {4,3,48,40,56,32}, {3,2,40,32,44,24}, {4,3,56,40,56,40}, {4,3,48,40,48,38}, 
-    {2,2,47,24,28,22}, {4,3,48,38,48,38}, {2,2,47,24,28,22}, {2,2,47,24,28,22}, {3,2,48,32,47,31}, {2,2,39,24,31,24}, {3,3,48,48,47,47}, {4,3,48,32,48,28}, 
-    {3,2,48,32,47,22}, {2,2,16,32,16,16}, {3,2,32,24,32,16}, {3,2,48,32,47,31}, {3,2,48,32,47,31}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {4,3,58,41,58,41}, 
-    {4,3,49,32,49,32}, {4,3,49,32,49,32}, {4,3,49,32,49,32}, {2,2,32,32,31,31}, {3,2,40,32,40,24}, {4,2,48,32,48,4}, {2,2,28,32,28,24}, {3,2,38,28,32,28}, 
-    {3,2,44,32,32,20}, {3,2,40,32,32,31}, {2,2,28,32,28,24}, {3,2,36,28,40,18}, {2,2,24,24,23,23}, {2,2,24,24,23,23}, {3,3,48,48,47,47}, {2,2,24,24,23,23}, 
-    {5,3,80,32,79,40}, {5,3,80,32,79,40}, {4,2,64,32,63,31}, {2,2,32,32,31,31}, {3,2,40,32,32,31}, {3,2,40,32,32,31}, {1,1,16,16,15,15}, {4,3,56,39,56,39}, 
-    {3,2,36,16,40,20}, {2,2,16,12,16,20}, {4,2,48,32,48,24}, {4,3,64,48,63,47}, {3,2,44,16,44,28}, {4,3,48,32,48,40}, {3,3,48,48,47,47}, {2,2,20,16,20,16}, 
-    {3,2,24,24,40,24}, {3,2,40,24,40,24}, {3,2,32,24,32,24}, {3,2,36,24,36,20}, {4,3,48,40,48,32}, {4,3,64,48,63,47}, {3,2,40,32,47,24}, {3,2,44,28,44,28}, 
-    {3,2,32,32,32,20}, {3,2,32,16,32,16}, {4,3,64,48,63,47}, {7,3,112,48,111,47}, {5,4,80,34,79,63}, {2,1,32,16,31,15}, {2,1,32,16,31,15}, {2,1,32,16,31,15}, 
-    {2,2,32,32,31,31}, {2,2,32,32,31,31}, {2,2,32,32,31,31}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {2,2,32,32,31,31}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, 
-    {1,1,16,16,15,15}, {4,2,64,32,63,31}, {3,2,48,32,47,31}, {5,3,80,38,69,47}, {3,2,48,32,47,31}, {3,2,48,32,47,31}, {3,2,48,32,47,31}, {3,2,48,32,47,31}, 
-    {3,2,48,32,47,31}, {3,2,48,32,47,31}, {3,2,48,32,47,31}, {3,2,48,32,47,31}, {3,2,48,32,47,31}, {4,3,56,28,63,43}, {3,2,48,32,47,31}, {5,5,80,80,79,79}, 
-    {2,2,32,32,31,31}, {8,4,128,64,127,63}, {3,2,25,17,44,20}, {3,2,44,17,25,20}, {3,2,41,17,28,20}, {3,2,28,17,41,20}, {2,2,32,32,31,31}, {1,1,16,16,15,15}, 
-    {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {4,3,48,32,48,32}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, 
-    {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, {1,1,16,16,15,15}, 
-    {1,1,16,16,15,15}, {0,0,0,0,0,0}, {0,0,0,0,0,0}, {0,0,0,0,0,0}, {0,0,0,0,0,0}, {0,0,0,0,0,0}, {0,0,0,0,0,0}
-  };
-
   namespace unitInternal
   {
     using namespace UnitTypes::Enum;
@@ -1296,88 +1270,6 @@ namespace BWAPI
     };
   }
 
-  static const int seekRangeTiles[UnitTypes::Enum::MAX] = {
-    0, 0, 0, 5, 0, 8, 8, 1, 0, 0, 3, 0, 0, 3, 0, 0, 0, 5, 0, 0, 0, 0, 0, 8, 0, 0, 12, 0, 0, 0, 0, 12, 3, 0, 9, 0, 0, 3, 0, 3, 3, 0, 
-    0, 3, 0, 8, 0, 3, 3, 8, 3, 3, 0, 0, 3, 3, 0, 0, 0, 0, 9, 3, 7, 7, 0, 3, 0, 3, 3, 0, 0, 0, 8, 0, 3, 3, 3, 3, 0, 3, 0, 8, 8, 8, 0, 
-    3, 0, 3, 0, 0, 0, 8, 4, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 5, 5, 2, 5, 2, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-  };
-  static const int sightRangeTiles[UnitTypes::Enum::MAX] = {
-    7, 9, 8, 8, 8, 10, 10, 7, 7, 10, 7, 8, 11, 3, 3, 7, 11, 8, 8, 8, 7, 7, 10, 10, 10, 10, 10, 8, 11, 11, 10, 10, 7, 10, 9, 4, 4, 5, 6, 
-    7, 5, 7, 9, 7, 11, 10, 10, 5, 7, 10, 5, 9, 10, 8, 5, 7, 11, 11, 8, 4, 9, 7, 10, 10, 8, 7, 8, 7, 8, 8, 8, 9, 11, 6, 7, 7, 8, 7, 8, 
-    7, 10, 10, 9, 10, 9, 5, 9, 7, 10, 7, 7, 8, 7, 7, 7, 7, 7, 4, 9, 10, 11, 10, 11, 8, 11, 8, 10, 10, 8, 8, 8, 8, 8, 8, 10, 8, 10, 8, 
-    8, 8, 8, 8, 8, 8, 11, 10, 10, 8, 5, 5, 10, 9, 10, 11, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10, 10, 7, 10, 8, 8, 7, 8, 8, 8, 7, 11, 10, 8, 10, 
-    7, 10, 10, 10, 11, 10, 10, 10, 10, 10, 8, 10, 10, 10, 10, 10, 10, 10, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 8, 10, 8, 8, 8, 8, 8, 
-    8, 8, 8, 8, 8, 10, 8, 6, 7, 1, 1, 1, 1, 6, 6, 3, 6, 3, 1, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0
-  };
-
-  namespace unitWeapons
-  {
-    using namespace WeaponTypes::Enum;
-    static const WeaponType groundWeapon[UnitTypes::Enum::MAX] = {
-      Gauss_Rifle, C_10_Canister_Rifle, Fragmentation_Grenade, Twin_Autocannons, Twin_Autocannons, Arclite_Cannon, Arclite_Cannon, 
-      Fusion_Cutter, Burst_Lasers, None, Flame_Thrower_Gui_Montag, None, ATS_Laser_Battery, Spider_Mines, None, None,
-      C_10_Canister_Rifle_Sarah_Kerrigan, Twin_Autocannons_Alan_Schezar, Twin_Autocannons_Alan_Schezar, Fragmentation_Grenade_Jim_Raynor,
-      Gauss_Rifle_Jim_Raynor, Burst_Lasers_Tom_Kazansky, None, Arclite_Cannon_Edmund_Duke, Arclite_Cannon_Edmund_Duke,
-      Arclite_Shock_Cannon_Edmund_Duke, Arclite_Shock_Cannon_Edmund_Duke, ATS_Laser_Battery_Hero, ATS_Laser_Battery_Hyperion, 
-      ATS_Laser_Battery_Hero, Arclite_Shock_Cannon, Arclite_Shock_Cannon, Flame_Thrower, None, None, None, None, Claws, Needle_Spines,
-      Kaiser_Blades, Toxic_Spores, Spines, None, Glave_Wurm, Acid_Spore, None, None, None, Kaiser_Blades_Torrasque, None,
-      Suicide_Infested_Terran, Claws_Infested_Kerrigan, None, Needle_Spines_Hunter_Killer, Claws_Devouring_One, Glave_Wurm_Kukulza,
-      Acid_Spore_Kukulza, None, None, None, None, Warp_Blades, None, None, Particle_Beam, Psi_Blades, Phase_Disruptor, None, 
-      Psionic_Shockwave, None, Dual_Photon_Blasters, Phase_Disruptor_Cannon, None, Pulse_Cannon, Warp_Blades_Hero, Warp_Blades_Zeratul, 
-      Psionic_Shockwave_TZ_Archon, Psi_Blades_Fenix, Phase_Disruptor_Fenix, Psi_Assault, Dual_Photon_Blasters_Mojo, None, None, None, 
-      None, Scarab, Phase_Disruptor_Cannon_Danimoth, Psi_Assault, Dual_Photon_Blasters_Artanis, None, None, None, None, None, None, None, 
-      None, None, None, C_10_Canister_Rifle_Samir_Duran, C_10_Canister_Rifle_Alexei_Stukov, None, ATS_Laser_Battery_Hero, 
-      Subterranean_Spines, C_10_Canister_Rifle_Infested_Duran, None, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, None, None, None, Subterranean_Tentacle, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, STS_Photon_Cannon, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, Platform_Laser_Battery, None, Independant_Laser_Battery, None, None, None, None, None, None, None, None, None, 
-      None, None, None, None, None, None, None, None, None, Hellfire_Missile_Pack_Floor_Trap, None, None, None, None, None, 
-      Twin_Autocannons_Floor_Trap, Hellfire_Missile_Pack_Wall_Trap, Flame_Thrower_Wall_Trap, Hellfire_Missile_Pack_Wall_Trap,
-      Flame_Thrower_Wall_Trap, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, Unknown
-    };
-    static const WeaponType airWeapon[UnitTypes::Enum::MAX] = {
-      Gauss_Rifle, C_10_Canister_Rifle, None, Hellfire_Missile_Pack, Hellfire_Missile_Pack, None, None, None, Gemini_Missiles, None, None, None, 
-      ATA_Laser_Battery, None, None, None, C_10_Canister_Rifle_Sarah_Kerrigan, Hellfire_Missile_Pack_Alan_Schezar, Hellfire_Missile_Pack_Alan_Schezar, None,
-      Gauss_Rifle_Jim_Raynor, Gemini_Missiles_Tom_Kazansky, None, None, None, None, None, ATA_Laser_Battery_Hero, 
-      ATA_Laser_Battery_Hyperion, ATA_Laser_Battery_Hero, None, None, None, None, None, None, None, None, Needle_Spines, None, 
-      None, None, None, Glave_Wurm, None, None, None, Suicide_Scourge, None, None, None, None, None, Needle_Spines_Hunter_Killer, 
-      None, Glave_Wurm_Kukulza, None, None, Halo_Rockets, None, Neutron_Flare, None, Corrosive_Acid, None, None, None, 
-      Phase_Disruptor, None, Psionic_Shockwave, None, Anti_Matter_Missiles, Phase_Disruptor_Cannon, None, Pulse_Cannon, None, 
-      None, Psionic_Shockwave_TZ_Archon, None, Phase_Disruptor_Fenix, None, Anti_Matter_Missiles_Mojo, None, None, None, None, 
-      None, Phase_Disruptor_Cannon_Danimoth, None, Anti_Matter_Missiles_Artanis, None, None, None, None, None, None, None, None, 
-      None, Neutron_Flare, C_10_Canister_Rifle_Samir_Duran, C_10_Canister_Rifle_Alexei_Stukov, None, ATA_Laser_Battery_Hero, None, 
-      C_10_Canister_Rifle_Infested_Duran, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, None, Longbolt_Missile, None, None, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, None, None, Seeker_Spores, None, None, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, STA_Photon_Cannon, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, 
-      None, None, None, None, None, None, None, None, None, None, None, Unknown
-    };
-  }
-
-  static const int groundWeaponHits[UnitTypes::Enum::MAX] = {
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 
-    1, 1, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 2, 1, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 2, 1, 1, 1, 0, 0, 0, 0, 1, 
-    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-  };
-  static const int airWeaponHits[UnitTypes::Enum::MAX] = {
-    1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 4, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 
-    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
-  };
-
   namespace unitSizes
   {
     using namespace UnitSizeTypes::Enum;
@@ -2457,11 +2349,11 @@ namespace BWAPI
   }
   int UnitType::maxHitPoints() const
   {
-    return defaultMaxHP[this->getID()];
+    return unitTypeData::table.maxHitPoints[this->getID()];
   }
   int UnitType::maxShields() const
   {
-    return defaultMaxSP[this->getID()];
+    return unitTypeData::table.maxShields[this->getID()];
   }
   int UnitType::maxEnergy() const
   {
@@ -2471,35 +2363,35 @@ namespace BWAPI
   }
   int UnitType::armor() const
   {
-    return defaultArmorAmount[this->getID()];
+    return unitTypeData::table.armor[this->getID()];
   }
   int UnitType::mineralPrice() const
   {
-    return defaultOreCost[this->getID()];
+    return unitTypeData::table.mineralPrice[this->getID()];
   }
   int UnitType::gasPrice() const
   {
-    return defaultGasCost[this->getID()];
+    return unitTypeData::table.gasPrice[this->getID()];
   }
   int UnitType::buildTime() const
   {
-    return defaultTimeCost[this->getID()];
+    return unitTypeData::table.buildTime[this->getID()];
   }
   int UnitType::supplyRequired() const
   {
-    return unitSupplyRequired[this->getID()];
+    return unitTypeData::table.supplyRequired[this->getID()];
   }
   int UnitType::supplyProvided() const
   {
-    return unitSupplyProvided[this->getID()];
+    return unitTypeData::table.supplyProvided[this->getID()];
   }
   int UnitType::spaceRequired() const
   {
-    return unitSpaceRequired[this->getID()];
+    return unitTypeData::table.spaceRequired[this->getID()];
   }
   int UnitType::spaceProvided() const
   {
-    return unitSpaceProvided[this->getID()];
+    return unitTypeData::table.spaceProvided[this->getID()];
   }
   int UnitType::buildScore() const
   {
@@ -2515,11 +2407,11 @@ namespace BWAPI
   }
   int UnitType::tileWidth() const
   {
-    return unitDimensions[this->getID()].tileWidth;
+    return unitTypeData::table.tileWidth[this->getID()];
   }
   int UnitType::tileHeight() const
   {
-    return unitDimensions[this->getID()].tileHeight;
+    return unitTypeData::table.tileHeight[this->getID()];
   }
   TilePosition UnitType::tileSize() const
   {
@@ -2527,19 +2419,19 @@ namespace BWAPI
   }
   int UnitType::dimensionLeft() const
   {
-    return unitDimensions[this->getID()].left;
+    return unitTypeData::table.dimensionLeft[this->getID()];
   }
   int UnitType::dimensionUp() const
   {
-    return unitDimensions[this->getID()].up;
+    return unitTypeData::table.dimensionUp[this->getID()];
   }
   int UnitType::dimensionRight() const
   {
-    return unitDimensions[this->getID()].right;
+    return unitTypeData::table.dimensionRight[this->getID()];
   }
   int UnitType::dimensionDown() const
   {
-    return unitDimensions[this->getID()].down;
+    return unitTypeData::table.dimensionDown[this->getID()];
   }
   int UnitType::width() const
   {
@@ -2551,27 +2443,27 @@ namespace BWAPI
   }
   int UnitType::seekRange() const
   {
-    return seekRangeTiles[this->getID()] * 32;
+    return unitTypeData::table.seekRangeTiles[this->getID()] * 32;
   }
   int UnitType::sightRange() const
   {
-    return sightRangeTiles[this->getID()] * 32;
+    return unitTypeData::table.sightRangeTiles[this->getID()] * 32;
   }
   WeaponType UnitType::groundWeapon() const
   {
-    return unitWeapons::groundWeapon[this->getID()];
+    return unitTypeData::table.groundWeapon[this->getID()];
   }
   int UnitType::maxGroundHits() const
   {
-    return groundWeaponHits[this->getID()];
+    return unitTypeData::table.maxGroundHits[this->getID()];
   }
   WeaponType UnitType::airWeapon() const
   {
-    return unitWeapons::airWeapon[this->getID()];
+    return unitTypeData::table.airWeapon[this->getID()];
   }
   int UnitType::maxAirHits() const
   {
-    return airWeaponHits[this->getID()];
+    return unitTypeData::table.maxAirHits[this->getID()];
   }
   double UnitType::topSpeed() const
   {
@@ -2591,7 +2483,7 @@ namespace BWAPI
   }
   bool UnitType::canProduce() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::ProducesUnits);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::ProducesUnits);
   }
   bool UnitType::canAttack() const
   {
@@ -2611,51 +2503,51 @@ namespace BWAPI
   }
   bool UnitType::canMove() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::AutoAttackAndMove);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::AutoAttackAndMove);
   }
   bool UnitType::isFlyer() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Flyer);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Flyer);
   }
   bool UnitType::regeneratesHP() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::RegeneratesHP);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::RegeneratesHP);
   }
   bool UnitType::isSpellcaster() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Spellcaster);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Spellcaster);
   }
   bool UnitType::hasPermanentCloak() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::PermanentCloak);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::PermanentCloak);
   }
   bool UnitType::isInvincible() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Invincible);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Invincible);
   }
   bool UnitType::isOrganic() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::OrganicUnit);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::OrganicUnit);
   }
   bool UnitType::isMechanical() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Mechanical);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Mechanical);
   }
   bool UnitType::isRobotic() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::RoboticUnit);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::RoboticUnit);
   }
   bool UnitType::isDetector() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Detector);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Detector);
   }
   bool UnitType::isResourceContainer() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::ResourceContainer);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::ResourceContainer);
   }
   bool UnitType::isResourceDepot() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::ResourceDepot);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::ResourceDepot);
   }
   bool UnitType::isRefinery() const
   {
@@ -2671,39 +2563,39 @@ namespace BWAPI
   }
   bool UnitType::isWorker() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Worker);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Worker);
   }
   bool UnitType::requiresPsi() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::RequiresPsi);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::RequiresPsi);
   }
   bool UnitType::requiresCreep() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::CreepBuilding);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::CreepBuilding);
   }
   bool UnitType::isTwoUnitsInOneEgg() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::TwoUnitsIn1Egg);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::TwoUnitsIn1Egg);
   }
   bool UnitType::isBurrowable() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Burrowable);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Burrowable);
   }
   bool UnitType::isCloakable() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Cloakable);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Cloakable);
   }
   bool UnitType::isBuilding() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Building);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Building);
   }
   bool UnitType::isAddon() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Addon);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Addon);
   }
   bool UnitType::isFlyingBuilding() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::FlyingBuilding);
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::FlyingBuilding);
   }
   bool UnitType::isNeutral() const
   {
@@ -2712,7 +2604,7 @@ namespace BWAPI
   }
   bool UnitType::isHero() const
   {
-    return !!(UnitPrototypeFlags::unitFlags[this->getID()] & UnitPrototypeFlags::Hero) ||
+    return !!(unitTypeData::table.flags[this->getID()] & UnitTypeFlags::Hero) ||
            this->getID() == UnitTypes::Hero_Dark_Templar ||
            this->getID() == UnitTypes::Terran_Civilian;
   }
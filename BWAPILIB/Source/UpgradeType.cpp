@@ -2,6 +2,7 @@
 #include <BWAPI/UpgradeType.h>
 #include <BWAPI/Race.h>
 #include <BWAPI/UnitType.h>
+#include <BWAPI/TypeTraits.h>
 
 #include "Common.h"
 
@@ -81,32 +82,40 @@ namespace BWAPI
   std::string upgradeLocalNames[UpgradeTypes::Enum::MAX];
 
   // DEFAULTS
-  static const int defaultOreCostBase[UpgradeTypes::Enum::MAX] =    // same as default gas cost base
-  { 
-    100, 100, 150, 150, 150, 100, 150, 100, 100, 100, 100, 100, 100, 100, 100, 200, 150, 100, 200, 150, 100, 150, 200, 150, 200, 150, 150, 100, 200,
-    150, 150, 150, 150, 150, 150, 200, 200, 200, 150, 150, 150, 100, 200, 100, 150, 0, 0, 100, 100, 150, 150, 150, 150, 200, 100, 0, 0, 0, 0, 0, 0, 0, 0
+  // Each table is expanded from UpgradeTypeData.inl through UpgradeTypeTraits, so the tables
+  // and the compile-time traits cannot disagree. Gas uses the mineral tables.
+#define BWAPI_UPGRADE_TYPE(id, ...) UpgradeTypeTraits<id>::BWAPI_UPGRADE_FIELD,
+  static const int defaultOreCostBase[UpgradeTypes::Enum::MAX] =
+  {
+#define BWAPI_UPGRADE_FIELD mineralPrice
+#include <BWAPI/UpgradeTypeData.inl>
+#undef BWAPI_UPGRADE_FIELD
   };
-  static const int defaultOreCostFactor[UpgradeTypes::Enum::MAX] =    // same as default gas cost factor
-  { 
-    75, 75, 75, 75, 75, 75, 75, 75, 75, 50, 50, 50, 75, 50, 75, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  static const int defaultOreCostFactor[UpgradeTypes::Enum::MAX] =
+  {
+#define BWAPI_UPGRADE_FIELD mineralPriceFactor
+#include <BWAPI/UpgradeTypeData.inl>
+#undef BWAPI_UPGRADE_FIELD
   };
   static const int defaultTimeCostBase[UpgradeTypes::Enum::MAX] =
-  { 
-    4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 4000, 1500, 1500, 0, 2500,
-    2500, 2500, 2500, 2500, 2400, 2000, 2000, 1500, 1500, 1500, 1500, 2500, 2500, 2500, 2000, 2500, 2500, 2500, 2000,
-    2000, 2500, 2500, 2500, 1500, 2500, 0, 0, 2500, 2500, 2500, 2500, 2500, 2000, 2000, 2000, 0, 0, 0, 0, 0, 0, 0, 0
+  {
+#define BWAPI_UPGRADE_FIELD upgradeTime
+#include <BWAPI/UpgradeTypeData.inl>
+#undef BWAPI_UPGRADE_FIELD
   };
   static const int defaultTimeCostFactor[UpgradeTypes::Enum::MAX] =
-  { 
-    480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 480, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+  {
+#define BWAPI_UPGRADE_FIELD upgradeTimeFactor
+#include <BWAPI/UpgradeTypeData.inl>
+#undef BWAPI_UPGRADE_FIELD
   };
-  static const int defaultMaxRepeats[UpgradeTypes::Enum::MAX] = 
+  static const int defaultMaxRepeats[UpgradeTypes::Enum::MAX] =
   {
-    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0
+#define BWAPI_UPGRADE_FIELD maxRepeats
+#include <BWAPI/UpgradeTypeData.inl>
+#undef BWAPI_UPGRADE_FIELD
   };
+#undef BWAPI_UPGRADE_TYPE
   // ACTUAL
   int oreCostBase[UpgradeTypes::Enum::MAX], gasCostBase[UpgradeTypes::Enum::MAX], timeCostBase[UpgradeTypes::Enum::MAX];
   int oreCostFactor[UpgradeTypes::Enum::MAX], gasCostFactor[UpgradeTypes::Enum::MAX], timeCostFactor[UpgradeTypes::Enum::MAX];
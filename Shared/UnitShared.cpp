@@ -1,6 +1,7 @@
 #include <BWAPI.h>
 #include <BWAPI/Client/UnitData.h>
 #include "UnitImpl.h"
+#include <GameImpl.h>
 #include <Templates.h>
 
 namespace BWAPI
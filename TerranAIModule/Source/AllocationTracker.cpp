@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "AllocationTracker.h"
+#include "Trace.h"
+
+namespace AllocationTracker {
+
+	static const char *const noScope = "(no scope)";
+	static const char *const otherScopes = "(other scopes)";
+
+	//running counts for one scope name; slots are claimed once and never released, so they can
+	//be updated from any thread without locks or allocation
+	typedef struct Slot_t {
+		std::atomic<const char*> scope;
+		std::atomic<int> allocations;
+		std::atomic<long long> bytes;
+	} Slot;
+
+	//the last slot collects whatever doesn't fit in the others
+	static Slot slots[ALLOCATION_TRACKER_SCOPES + 1];
+	//counts moved out of the slots at the end of the last frame
+	static ScopeAllocations lastFrame[ALLOCATION_TRACKER_SCOPES + 1];
+	static int lastFrameCount = 0;
+
+	bool isEnabled() {
+		return ALLOCATION_TRACKING != 0;
+	}
+
+	///<summary>Finds the slot for a scope name, claiming a free one if it has none yet. Names
+	///are compared by address; the same literal in two files may get two slots, which the
+	///report merges.</summary>
+	Slot &getSlot(const char *scope) {
+		size_t start = ((size_t)scope >> 3) % ALLOCATION_TRACKER_SCOPES;
+		for (int i = 0; i < ALLOCATION_TRACKER_SCOPES; i++) {
+			Slot &slot = slots[(start + i) % ALLOCATION_TRACKER_SCOPES];
+			const char *owner = slot.scope.load(std::memory_order_acquire);
+			if (owner == scope)
+				return slot;
+			if (owner == nullptr) {
+				const char *expected = nullptr;
+				if (slot.scope.compare_exchange_strong(expected, scope) || expected == scope)
+					return slot;
+			}
+		}
+		Slot &overflow = slots[ALLOCATION_TRACKER_SCOPES];
+		overflow.scope.store(otherScopes, std::memory_order_release);
+		return overflow;
+	}
+
+	///<summary>Counts one allocation against the calling thread's innermost trace scope.</summary>
+	void countAllocation(size_t bytes) {
+		const char *scope = Trace::getCurrentScope();
+		Slot &slot = getSlot(scope ? scope : noScope);
+		slot.allocations.fetch_add(1, std::memory_order_relaxed);
+		slot.bytes.fetch_add((long long)bytes, std::memory_order_relaxed);
+	}
+
+	///<summary>Moves the counts gathered since the last call into the frame report. Called once
+	///per frame by Trace::endFrame.</summary>
+	void endFrame() {
+		lastFrameCount = 0;
+		for (auto &slot : slots) {
+			const char *scope = slot.scope.load(std::memory_order_acquire);
+			if (!scope)
+				continue;
+			int allocations = slot.allocations.exchange(0);
+			long long bytes = slot.bytes.exchange(0);
+			if (allocations == 0)
+				continue;
+			//merge slots whose names only differ by address
+			int i = 0;
+			while (i < lastFrameCount && std::strcmp(lastFrame[i].scope, scope) != 0)
+				i++;
+			if (i == lastFrameCount) {
+				lastFrame[i].scope = scope;
+				lastFrame[i].allocations = 0;
+				lastFrame[i].bytes = 0;
+				lastFrameCount++;
+			}
+			lastFrame[i].allocations += allocations;
+			lastFrame[i].bytes += bytes;
+		}
+	}
+
+	///<summary>Copies last frame's counts, busiest scope first, into the report and returns how
+	///many were copied. Doesn't allocate.</summary>
+	int getFrameReport(ScopeAllocations *report, int maxScopes) {
+		int count = std::min(maxScopes, lastFrameCount);
+		std::partial_sort_copy(lastFrame, lastFrame + lastFrameCount, report, report + count,
+			[](const ScopeAllocations &a, const ScopeAllocations &b) { return a.allocations > b.allocations; });
+		return count;
+	}
+
+}
+
+#if ALLOCATION_TRACKING
+//The bot's own allocations go through here; BWAPI.dll's don't. Memory still comes from the
+//CRT's malloc, the same heap the default operator new uses, so memory allocated on one side
+//of the DLL boundary can still be freed on the other.
+void *operator new(size_t size) {
+	AllocationTracker::countAllocation(size);
+	void *p = std::malloc(size ? size : 1);
+	if (!p)
+		throw std::bad_alloc();
+	return p;
+}
+void *operator new[](size_t size) {
+	return operator new(size);
+}
+void *operator new(size_t size, const std::nothrow_t&) throw() {
+	AllocationTracker::countAllocation(size);
+	return std::malloc(size ? size : 1);
+}
+void *operator new[](size_t size, const std::nothrow_t&) throw() {
+	return operator new(size, std::nothrow);
+}
+void operator delete(void *p) throw() {
+	std::free(p);
+}
+void operator delete[](void *p) throw() {
+	std::free(p);
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Shared.h"
+
+//set to 1 to count every heap allocation the bot makes; replaces the global operator new
+#define ALLOCATION_TRACKING 0
+//distinct trace scopes allocations can be attributed to; the rest are counted together
+#define ALLOCATION_TRACKER_SCOPES 128
+
+namespace AllocationTracker {
+
+	//allocations made while one trace scope was the innermost on its thread
+	typedef struct ScopeAllocations_t {
+		//name of the scope, or "(no scope)" for allocations made outside any
+		const char *scope;
+		int allocations;
+		long long bytes;
+	} ScopeAllocations;
+
+	bool isEnabled();
+	void countAllocation(size_t bytes);
+	void endFrame();
+	int getFrameReport(ScopeAllocations *report, int maxScopes);
+
+}
\ No newline at end of file
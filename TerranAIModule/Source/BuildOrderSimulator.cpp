@@ -0,0 +1,607 @@
+#include <climits>
+#include <mutex>
+#include <condition_variable>
+
+#include "BuildOrderSimulator.h"
+#include "ThreadPool.h"
+
+using namespace BWAPI;
+using UnitBehavior::Goal;
+
+namespace BuildOrderSimulator {
+
+	//flattened copy of the UnitType data the simulator needs, so worker threads never touch BWAPI
+	typedef struct SimUnitInfo_t {
+		int mineralPrice;
+		int gasPrice;
+		int buildTime;
+		int supplyRequired;
+		int supplyProvided;
+		//unit type that trains or builds this unit
+		int whatBuilds;
+		//required unit types other than whatBuilds
+		int requirements[4];
+		int requirementCount;
+		bool isAddon;
+		bool isWorker;
+	} SimUnitInfo;
+
+	//flattened copy of the TechType data the simulator needs
+	typedef struct SimTechInfo_t {
+		int mineralPrice;
+		int gasPrice;
+		int researchTime;
+		int whatResearches;
+		int requiredUnit;
+	} SimTechInfo;
+
+	//an entry in the simulated goal queue
+	typedef struct SimItem_t {
+		bool isResearch;
+		//unit or tech type id
+		int type;
+		//position of the goal in the list being simulated, or -1 for inserted prerequisites and depots
+		int goalIndex;
+	} SimItem;
+
+	//result of trying to start the item at the front of the simulated goal queue
+	enum SimStep {
+		STARTED,
+		BLOCKED,
+		INSERTED
+	};
+
+	static SimUnitInfo unitInfo[UnitTypes::Enum::MAX];
+	static SimTechInfo techInfo[TechTypes::Enum::MAX];
+	static std::vector<int> addonTypes;
+	static bool typeTablesBuilt = false;
+
+	///<summary>Copies the UnitType and TechType data used by the simulator into flat tables.
+	///Must run on the game thread before any simulation is handed to a worker thread.</summary>
+	void buildTypeTables() {
+		if (typeTablesBuilt)
+			return;
+		for (int i = 0; i < UnitTypes::Enum::MAX; i++) {
+			UnitType type(i);
+			SimUnitInfo &info = unitInfo[i];
+			info.mineralPrice = type.mineralPrice();
+			info.gasPrice = type.gasPrice();
+			info.buildTime = type.buildTime();
+			info.supplyRequired = type.supplyRequired();
+			info.supplyProvided = type.supplyProvided();
+			info.whatBuilds = type.whatBuilds().first;
+			info.isAddon = type.isAddon();
+			info.isWorker = type.isWorker();
+			info.requirementCount = 0;
+			for (auto &r : type.requiredUnits()) {
+				//whoever builds the unit is checked separately
+				if (r.first == type.whatBuilds().first || info.requirementCount >= 4)
+					continue;
+				info.requirements[info.requirementCount++] = r.first;
+			}
+			if (info.isAddon && type.getRace() == Races::Terran)
+				addonTypes.push_back(i);
+		}
+		for (int i = 0; i < TechTypes::Enum::MAX; i++) {
+			TechType tech(i);
+			SimTechInfo &info = techInfo[i];
+			info.mineralPrice = tech.mineralPrice();
+			info.gasPrice = tech.gasPrice();
+			info.researchTime = tech.researchTime();
+			info.whatResearches = tech.whatResearches();
+			info.requiredUnit = tech.requiredUnit();
+		}
+		typeTablesBuilt = true;
+	}
+
+	bool laterEvent(const SimEvent &a, const SimEvent &b) {
+		return a.frame > b.frame;
+	}
+
+	void schedule(SimState &s, const SimEvent &e) {
+		s.events.push_back(e);
+		std::push_heap(s.events.begin(), s.events.end(), laterEvent);
+	}
+
+	int gasWorkers(const SimState &s) {
+		//mirror the refinery logic: nobody mines gas until we have enough workers
+		if (s.workers <= WORKERS_REQUIRED_BEFORE_MINING_GAS)
+			return 0;
+		return std::min(s.completed[UnitTypes::Terran_Refinery] * 3, s.workers - s.builders);
+	}
+
+	int mineralWorkers(const SimState &s) {
+		return std::max(0, s.workers - s.builders - gasWorkers(s));
+	}
+
+	///<summary>Accumulates income up to the specified frame. Income rates are constant
+	///between events, so this is a single multiplication.</summary>
+	void accrue(SimState &s, int frame) {
+		int elapsed = frame - s.frame;
+		if (elapsed <= 0)
+			return;
+		s.minerals += mineralWorkers(s) * SIM_MINERALS_PER_WORKER_FRAME * elapsed;
+		s.gas += gasWorkers(s) * SIM_GAS_PER_WORKER_FRAME * elapsed;
+		s.frame = frame;
+	}
+
+	///<summary>Returns true if the state can afford the specified price right now. If it can't,
+	///lowers nextFrame to the frame on which the price will be affordable at current income.</summary>
+	bool canAfford(const SimState &s, int minerals, int gas, int &nextFrame) {
+		int mineralDeficit = minerals * SIM_RESOURCE_SCALE - s.minerals;
+		int gasDeficit = gas * SIM_RESOURCE_SCALE - s.gas;
+		if (mineralDeficit <= 0 && gasDeficit <= 0)
+			return true;
+
+		int wait = 0;
+		if (mineralDeficit > 0) {
+			int rate = mineralWorkers(s) * SIM_MINERALS_PER_WORKER_FRAME;
+			if (rate == 0)
+				return false; //only an event can help us now
+			wait = std::max(wait, (mineralDeficit + rate - 1) / rate);
+		}
+		if (gasDeficit > 0) {
+			int rate = gasWorkers(s) * SIM_GAS_PER_WORKER_FRAME;
+			if (rate == 0)
+				return false;
+			wait = std::max(wait, (gasDeficit + rate - 1) / rate);
+		}
+		nextFrame = std::min(nextFrame, s.frame + wait);
+		return false;
+	}
+
+	void pay(SimState &s, int minerals, int gas) {
+		s.minerals -= minerals * SIM_RESOURCE_SCALE;
+		s.gas -= gas * SIM_RESOURCE_SCALE;
+	}
+
+	///<summary>Counts addons attached to, or under construction on, structures of the specified type.</summary>
+	int countAddonsOf(const SimState &s, int parent) {
+		int count = 0;
+		for (int addon : addonTypes) {
+			if (unitInfo[addon].whatBuilds == parent)
+				count += s.completed[addon] + s.pending[addon];
+		}
+		return count;
+	}
+
+	///<summary>Checks that a unit type we depend on exists. If it doesn't and nothing is
+	///producing it, pushes it to the front of the queue the same way evaluateGoals does.</summary>
+	SimStep requireUnit(const SimState &s, std::deque<SimItem> &queue, int type) {
+		if (type == UnitTypes::None || s.completed[type] > 0)
+			return STARTED;
+		if (s.pending[type] == 0) {
+			SimItem prerequisite;
+			prerequisite.isResearch = false;
+			prerequisite.type = type;
+			prerequisite.goalIndex = -1;
+			queue.push_front(prerequisite);
+			return INSERTED;
+		}
+		return BLOCKED;
+	}
+
+	SimStep tryStartResearch(SimState &s, std::deque<SimItem> &queue, int &nextFrame) {
+		SimItem item = queue.front();
+		const SimTechInfo &info = techInfo[item.type];
+
+		SimStep step = requireUnit(s, queue, info.requiredUnit);
+		if (step != STARTED)
+			return step;
+		step = requireUnit(s, queue, info.whatResearches);
+		if (step != STARTED)
+			return step;
+		if (s.completed[info.whatResearches] - s.busy[info.whatResearches] <= 0)
+			return BLOCKED;
+		if (!canAfford(s, info.mineralPrice, info.gasPrice, nextFrame))
+			return BLOCKED;
+
+		pay(s, info.mineralPrice, info.gasPrice);
+		s.busy[info.whatResearches]++;
+		s.researching[item.type] = true;
+
+		SimEvent e;
+		e.frame = s.frame + info.researchTime;
+		e.isResearch = true;
+		e.type = item.type;
+		e.producer = info.whatResearches;
+		e.freesBuilder = false;
+		e.goalIndex = item.goalIndex;
+		schedule(s, e);
+		queue.pop_front();
+		return STARTED;
+	}
+
+	SimStep tryStartStructure(SimState &s, std::deque<SimItem> &queue, int &nextFrame) {
+		SimItem item = queue.front();
+		const SimUnitInfo &info = unitInfo[item.type];
+
+		for (int i = 0; i < info.requirementCount; i++) {
+			SimStep step = requireUnit(s, queue, info.requirements[i]);
+			if (step != STARTED)
+				return step;
+		}
+
+		if (info.isAddon) {
+			//we need a structure without an addon to attach this to
+			if (s.completed[info.whatBuilds] - countAddonsOf(s, info.whatBuilds) <= 0) {
+				if (s.pending[info.whatBuilds] > 0)
+					return BLOCKED;
+				SimItem parent;
+				parent.isResearch = false;
+				parent.type = info.whatBuilds;
+				parent.goalIndex = -1;
+				queue.push_front(parent);
+				return INSERTED;
+			}
+		}
+		else if (s.workers - s.builders <= 0) {
+			return BLOCKED;
+		}
+		if (!canAfford(s, info.mineralPrice, info.gasPrice, nextFrame))
+			return BLOCKED;
+
+		pay(s, info.mineralPrice, info.gasPrice);
+		s.pending[item.type]++;
+
+		SimEvent e;
+		e.frame = s.frame + info.buildTime;
+		e.isResearch = false;
+		e.type = item.type;
+		e.producer = info.isAddon ? info.whatBuilds : -1;
+		e.freesBuilder = !info.isAddon;
+		e.goalIndex = item.goalIndex;
+		if (info.isAddon)
+			s.busy[info.whatBuilds]++;
+		else
+			s.builders++;
+		schedule(s, e);
+		queue.pop_front();
+		return STARTED;
+	}
+
+	///<summary>Returns the number of supply depots the bot would decide to build in this state,
+	///using the same projection as ResourceLogic::getRequiredSupplyDepots.</summary>
+	int requiredSupplyDepots(const SimState &s) {
+		int projectedSupplyUsage = s.supplyUsed + 2 + (s.supplyUsed / 10) +
+			s.pending[UnitTypes::Terran_SCV] * unitInfo[UnitTypes::Terran_SCV].supplyRequired;
+		int requiredSupply = projectedSupplyUsage - s.supplyTotal;
+		int depots = (requiredSupply + 15) / 16 - s.pending[UnitTypes::Terran_Supply_Depot];
+		return depots > 0 ? depots : 0;
+	}
+
+	///<summary>Trains workers from every idle command center, as evaluateTownhallLogicFor does.</summary>
+	void trainWorkers(SimState &s, int &nextFrame) {
+		const SimUnitInfo &scv = unitInfo[UnitTypes::Terran_SCV];
+		int idleTownhalls = s.completed[UnitTypes::Terran_Command_Center] - s.busy[UnitTypes::Terran_Command_Center];
+		while (idleTownhalls > 0 &&
+			s.workers + s.pending[UnitTypes::Terran_SCV] < MAXIMUM_WORKER_COUNT &&
+			s.supplyUsed + scv.supplyRequired <= s.supplyTotal &&
+			canAfford(s, scv.mineralPrice, scv.gasPrice, nextFrame))
+		{
+			pay(s, scv.mineralPrice, scv.gasPrice);
+			s.busy[UnitTypes::Terran_Command_Center]++;
+			s.pending[UnitTypes::Terran_SCV]++;
+			s.supplyUsed += scv.supplyRequired;
+
+			SimEvent e;
+			e.frame = s.frame + scv.buildTime;
+			e.isResearch = false;
+			e.type = UnitTypes::Terran_SCV;
+			e.producer = UnitTypes::Terran_Command_Center;
+			e.freesBuilder = false;
+			e.goalIndex = -1;
+			schedule(s, e);
+			idleTownhalls--;
+		}
+	}
+
+	void resolveEvent(SimState &s, const SimEvent &e, std::vector<int> &completionFrames, int &outstanding) {
+		if (e.isResearch) {
+			s.researching[e.type] = false;
+			s.researched[e.type] = true;
+		}
+		else {
+			s.pending[e.type]--;
+			s.completed[e.type]++;
+			s.supplyTotal = std::min(400, s.supplyTotal + unitInfo[e.type].supplyProvided);
+			if (unitInfo[e.type].isWorker)
+				s.workers++;
+		}
+		if (e.producer >= 0)
+			s.busy[e.producer]--;
+		if (e.freesBuilder)
+			s.builders--;
+		if (e.goalIndex >= 0 && completionFrames[e.goalIndex] < 0) {
+			completionFrames[e.goalIndex] = e.frame;
+			outstanding--;
+		}
+	}
+
+	///<summary>Moves the simulation forward to the specified frame, resolving every event on the way.</summary>
+	void advance(SimState &s, int frame, std::vector<int> &completionFrames, int &outstanding) {
+		while (!s.events.empty() && s.events.front().frame <= frame) {
+			SimEvent e = s.events.front();
+			std::pop_heap(s.events.begin(), s.events.end(), laterEvent);
+			s.events.pop_back();
+			//income changes when a worker or refinery finishes, so accrue up to the event first
+			accrue(s, e.frame);
+			resolveEvent(s, e, completionFrames, outstanding);
+		}
+		accrue(s, frame);
+	}
+
+	///<summary>Simulates the goals in the specified order. Goals are weighted for tie breaking by
+	///their position in the goals list rather than their position in the order.</summary>
+	SimResult runSimulation(const SimState &start, const std::vector<Goal> &goals, const std::vector<int> &order, int horizon) {
+		SimState s = start;
+		int endFrame = start.frame + horizon;
+		int goalCount = (int)goals.size();
+
+		std::deque<SimItem> queue;
+		for (int i : order) {
+			SimItem item;
+			item.isResearch = goals[i].isResearch;
+			item.type = goals[i].isResearch ? goals[i].tech.getID() : goals[i].structureType.getID();
+			item.goalIndex = i;
+			queue.push_back(item);
+		}
+		std::vector<int> completionFrames(goalCount, -1);
+		int outstanding = goalCount;
+
+		while (outstanding > 0 && s.frame <= endFrame) {
+			int nextFrame = INT_MAX;
+
+			//a depot comes before any goal, just as it does in the worker logic
+			bool supplyBlocked = false;
+			if (requiredSupplyDepots(s) > 0) {
+				SimItem depot;
+				depot.isResearch = false;
+				depot.type = UnitTypes::Terran_Supply_Depot;
+				depot.goalIndex = -1;
+				queue.push_front(depot);
+				if (tryStartStructure(s, queue, nextFrame) != STARTED) {
+					queue.pop_front();
+					supplyBlocked = true;
+				}
+			}
+
+			//take the geyser at each base once we have enough workers, as the townhall logic does
+			if (!supplyBlocked &&
+				s.workers > WORKERS_REQUIRED_BEFORE_MINING_GAS &&
+				s.completed[UnitTypes::Terran_Refinery] + s.pending[UnitTypes::Terran_Refinery] <
+				s.completed[UnitTypes::Terran_Command_Center])
+			{
+				SimItem refinery;
+				refinery.isResearch = false;
+				refinery.type = UnitTypes::Terran_Refinery;
+				refinery.goalIndex = -1;
+				queue.push_front(refinery);
+				if (tryStartStructure(s, queue, nextFrame) != STARTED)
+					queue.pop_front();
+			}
+
+			//start as many goals as we can on this frame
+			while (!supplyBlocked && !queue.empty()) {
+				SimItem &item = queue.front();
+				if (item.isResearch && (s.researched[item.type] || s.researching[item.type])) {
+					//someone else already took care of this tech
+					if (item.goalIndex >= 0 && completionFrames[item.goalIndex] < 0) {
+						completionFrames[item.goalIndex] = s.frame;
+						outstanding--;
+					}
+					queue.pop_front();
+					continue;
+				}
+				SimStep step = item.isResearch ?
+					tryStartResearch(s, queue, nextFrame) :
+					tryStartStructure(s, queue, nextFrame);
+				if (step == BLOCKED)
+					break;
+				//prerequisites can't be satisfied; give up rather than grow the queue forever
+				if (queue.size() > goals.size() + 32)
+					break;
+			}
+
+			trainWorkers(s, nextFrame);
+
+			if (outstanding == 0)
+				break;
+			if (!s.events.empty())
+				nextFrame = std::min(nextFrame, s.events.front().frame);
+			if (nextFrame == INT_MAX || nextFrame > endFrame)
+				break; //deadlocked, or out of time
+			advance(s, std::max(nextFrame, s.frame + 1), completionFrames, outstanding);
+		}
+
+		SimResult result;
+		result.feasible = outstanding == 0;
+		result.finishFrame = start.frame;
+		result.weightedFrames = 0;
+		result.workers = s.workers;
+		for (int i = 0; i < goalCount; i++) {
+			int frame = completionFrames[i] < 0 ? endFrame + 1 : completionFrames[i];
+			result.finishFrame = std::max(result.finishFrame, frame);
+			//goals listed earlier were deemed more important, so finishing them early counts for more
+			result.weightedFrames += (frame - start.frame) * (goalCount - i);
+		}
+		return result;
+	}
+
+	bool isBetter(const SimResult &a, const SimResult &b) {
+		if (a.feasible != b.feasible)
+			return a.feasible;
+		if (a.finishFrame != b.finishFrame)
+			return a.finishFrame < b.finishFrame;
+		return a.weightedFrames < b.weightedFrames;
+	}
+
+	///<summary>Writes the permutation with the specified lexicographic index into the first
+	///length entries of order. Entries past length keep their original position.</summary>
+	void decodePermutation(int index, int length, std::vector<int> &order) {
+		std::vector<int> pool;
+		int radix = 1;
+		for (int i = 0; i < length; i++) {
+			pool.push_back(i);
+			if (i > 0)
+				radix *= i;
+		}
+		for (int i = 0; i < length; i++) {
+			int digit = index / radix;
+			index %= radix;
+			order[i] = pool[digit];
+			pool.erase(pool.begin() + digit);
+			if (length - 1 - i > 0)
+				radix /= (length - 1 - i);
+		}
+		for (int i = length; i < (int)order.size(); i++)
+			order[i] = i;
+	}
+
+	///<summary>Builds an abstract snapshot of our current economy.</summary>
+	SimState getCurrentState() {
+		buildTypeTables();
+
+		SimState s;
+		s.frame = Broodwar->getFrameCount();
+		s.minerals = Broodwar->self()->minerals() * SIM_RESOURCE_SCALE;
+		s.gas = Broodwar->self()->gas() * SIM_RESOURCE_SCALE;
+		s.supplyUsed = Broodwar->self()->supplyUsed();
+		s.supplyTotal = Broodwar->self()->supplyTotal();
+		s.workers = 0;
+		s.builders = 0;
+		for (int i = 0; i < UnitTypes::Enum::MAX; i++) {
+			s.completed[i] = 0;
+			s.pending[i] = 0;
+			s.busy[i] = 0;
+		}
+		for (int i = 0; i < TechTypes::Enum::MAX; i++) {
+			s.researched[i] = Broodwar->self()->hasResearched(TechType(i));
+			s.researching[i] = false;
+		}
+
+		for (auto &u : Broodwar->self()->getUnits()) {
+			if (!u->exists())
+				continue;
+			UnitType type = u->getType();
+			SimEvent e;
+			e.isResearch = false;
+			e.producer = -1;
+			e.freesBuilder = false;
+			e.goalIndex = -1;
+
+			if (!u->isCompleted()) {
+				//units in training show up through their producer below
+				if (!type.isBuilding())
+					continue;
+				s.pending[type]++;
+				e.frame = s.frame + u->getRemainingBuildTime();
+				e.type = type;
+				if (type.isAddon()) {
+					e.producer = type.whatBuilds().first;
+					s.busy[e.producer]++;
+				}
+				else if (u->getBuildUnit()) {
+					e.freesBuilder = true;
+					s.builders++;
+				}
+				schedule(s, e);
+				continue;
+			}
+
+			s.completed[type]++;
+			if (type.isWorker())
+				s.workers++;
+			if (u->isTraining() && !u->getTrainingQueue().empty()) {
+				UnitType trainee = u->getTrainingQueue()[0];
+				s.pending[trainee]++;
+				s.busy[type]++;
+				e.frame = s.frame + u->getRemainingTrainTime();
+				e.type = trainee;
+				e.producer = type;
+				schedule(s, e);
+			}
+			else if (u->isResearching()) {
+				s.researching[u->getTech()] = true;
+				s.busy[type]++;
+				e.frame = s.frame + u->getRemainingResearchTime();
+				e.isResearch = true;
+				e.type = u->getTech();
+				e.producer = type;
+				schedule(s, e);
+			}
+		}
+		return s;
+	}
+
+	///<summary>Simulates the goals in the order given and reports when they finish.</summary>
+	SimResult simulate(const SimState &start, const std::vector<Goal> &goals, int horizon) {
+		buildTypeTables();
+		std::vector<int> order(goals.size());
+		for (int i = 0; i < (int)order.size(); i++)
+			order[i] = i;
+		return runSimulation(start, goals, order, horizon);
+	}
+
+	///<summary>Simulates every ordering of the specified goals on the shared thread pool and returns the
+	///ordering that completes them soonest. Ties go to the ordering that best preserves the
+	///original priorities, and then to the lowest permutation index, so the result is deterministic.
+	///Only the first SIM_MAX_EXHAUSTIVE_GOALS goals are permuted.</summary>
+	std::vector<Goal> findBestOrdering(const SimState &start, const std::vector<Goal> &goals, int horizon) {
+		//the tables must be built here, on the game thread, before any worker reads them
+		buildTypeTables();
+
+		int goalCount = (int)goals.size();
+		if (goalCount < 2)
+			return goals;
+		int head = std::min(goalCount, SIM_MAX_EXHAUSTIVE_GOALS);
+		int permutations = 1;
+		for (int i = 2; i <= head; i++)
+			permutations *= i;
+
+		ThreadPool &pool = ThreadPool::getShared();
+		int threadCount = std::min(pool.getThreadCount(), permutations);
+		std::vector<SimResult> bestResults(threadCount);
+		std::vector<int> bestIndices(threadCount, -1);
+
+		std::mutex doneMutex;
+		std::condition_variable allDone;
+		int running = threadCount;
+		for (int t = 0; t < threadCount; t++) {
+			pool.enqueue([&, t]() {
+				std::vector<int> order(goalCount);
+				//each task takes every threadCount-th permutation, in ascending order
+				for (int p = t; p < permutations; p += threadCount) {
+					decodePermutation(p, head, order);
+					SimResult r = runSimulation(start, goals, order, horizon);
+					if (bestIndices[t] == -1 || isBetter(r, bestResults[t])) {
+						bestResults[t] = r;
+						bestIndices[t] = p;
+					}
+				}
+				std::lock_guard<std::mutex> lock(doneMutex);
+				running--;
+				allDone.notify_one();
+			});
+		}
+		{
+			std::unique_lock<std::mutex> lock(doneMutex);
+			allDone.wait(lock, [&running]() { return running == 0; });
+		}
+
+		int best = 0;
+		for (int t = 1; t < threadCount; t++) {
+			if (isBetter(bestResults[t], bestResults[best]) ||
+				(!isBetter(bestResults[best], bestResults[t]) && bestIndices[t] < bestIndices[best]))
+				best = t;
+		}
+
+		std::vector<int> order(goalCount);
+		decodePermutation(bestIndices[best], head, order);
+		std::vector<Goal> ordered;
+		for (int i : order)
+			ordered.push_back(goals[i]);
+		return ordered;
+	}
+
+}
\ No newline at end of file
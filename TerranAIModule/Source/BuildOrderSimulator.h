@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Shared.h"
+#include "UnitBehavior.h"
+
+//abstract income rates, in thousandths of a resource per worker per frame
+#define SIM_MINERALS_PER_WORKER_FRAME 45
+#define SIM_GAS_PER_WORKER_FRAME 37
+//scale applied to simulated mineral and gas counts so income stays in integer math
+#define SIM_RESOURCE_SCALE 1000
+//default simulation horizon: ten minutes of game time
+#define SIM_DEFAULT_HORIZON (24 * 60 * 10)
+//goal lists up to this length have every ordering tried; longer lists only permute their head
+#define SIM_MAX_EXHAUSTIVE_GOALS 8
+
+namespace BuildOrderSimulator {
+
+	//something that finishes at a known frame in the simulation
+	typedef struct SimEvent_t {
+		//frame on which the event resolves
+		int frame;
+		//whether the event completes a tech as opposed to a unit
+		bool isResearch;
+		//unit or tech type id being completed
+		int type;
+		//unit type id of the producer freed by this event, or -1
+		int producer;
+		//whether an SCV is released back to mining by this event
+		bool freesBuilder;
+		//index of the simulated goal completed by this event, or -1
+		int goalIndex;
+	} SimEvent;
+
+	//abstract snapshot of our economy; contains no BWAPI handles so it can be copied across threads
+	typedef struct SimState_t {
+		int frame;
+		//resources are scaled by SIM_RESOURCE_SCALE
+		int minerals;
+		int gas;
+		int supplyUsed;
+		int supplyTotal;
+		//completed workers, including those busy constructing
+		int workers;
+		//workers currently away from the minerals constructing a structure
+		int builders;
+		//count of completed units of each type
+		int completed[BWAPI::UnitTypes::Enum::MAX];
+		//count of units of each type under construction or in training
+		int pending[BWAPI::UnitTypes::Enum::MAX];
+		//count of units of each type that are busy training, researching or building an addon
+		int busy[BWAPI::UnitTypes::Enum::MAX];
+		bool researched[BWAPI::TechTypes::Enum::MAX];
+		bool researching[BWAPI::TechTypes::Enum::MAX];
+		//pending completions, kept as a min-heap on frame
+		std::vector<SimEvent> events;
+	} SimState;
+
+	typedef struct SimResult_t {
+		//whether every goal was completed within the horizon
+		bool feasible;
+		//frame on which the last goal completed
+		int finishFrame;
+		//sum of goal completion frames weighted by their original priority; used to break ties
+		int weightedFrames;
+		//number of workers owned at the end of the simulation
+		int workers;
+	} SimResult;
+
+	SimState getCurrentState();
+	SimResult simulate(const SimState &start, const std::vector<UnitBehavior::Goal> &goals, int horizon = SIM_DEFAULT_HORIZON);
+	std::vector<UnitBehavior::Goal> findBestOrdering(const SimState &start, const std::vector<UnitBehavior::Goal> &goals, int horizon = SIM_DEFAULT_HORIZON);
+
+}
\ No newline at end of file
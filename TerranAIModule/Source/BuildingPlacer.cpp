@@ -1,4 +1,6 @@
 #include "BuildingPlacer.h"
+#include "Trace.h"
+#include "PathFinder.h"
 
 BuildingPlacer::BuildingPlacer()
 {
@@ -60,7 +62,7 @@ bool BuildingPlacer::canBuildHereWithSpace(BWAPI::TilePosition position, BWAPI::
 		for (int x = startx2; x < startx; ++x)
 			for (int y = starty; y < endy; ++y)
 			{
-					for (auto &u : BWAPI::Broodwar->getUnitsOnTile(x, y))
+					for (auto &u : TRACE_CALL("getUnitsOnTile", BWAPI::Broodwar->getUnitsOnTile(x, y)))
 				{
 					if (!u->isLifted() && u->getType().canBuildAddon())
 						return false;
@@ -86,8 +88,38 @@ BWAPI::TilePosition BuildingPlacer::getBuildLocationNear(BWAPI::TilePosition pos
 
 BWAPI::TilePosition BuildingPlacer::getBuildLocationNear(BWAPI::TilePosition position, BWAPI::UnitType type, int buildDist) const
 {
-	//returns a valid build location near the specified tile position.
-	//searches outward in a spiral.
+	return getBuildLocationNear(position, type, buildDist, nullptr);
+}
+
+BWAPI::TilePosition BuildingPlacer::getBuildLocationNear(BWAPI::Unit builder, BWAPI::UnitType type) const
+{
+	return getBuildLocationNear(builder->getTilePosition(), type, this->buildDistance, builder);
+}
+
+static bool isReachableIn(const PathFinder::Reach &reach, BWAPI::Unit builder, BWAPI::TilePosition position, BWAPI::UnitType type)
+{
+	//returns true if the builder can walk to the site. Region groups rule out other islands
+	//cheaply; the flood from the builder catches nearby sites walled in by buildings. Sites
+	//beyond the flood are only checked against region groups.
+	BWAPI::Position site = BWAPI::Position(position) + BWAPI::Position(type.tileWidth() * TILE_SIZE / 2, type.tileHeight() * TILE_SIZE / 2);
+	if (!BWAPI::Broodwar->hasPath(builder->getPosition(), site))
+		return false;
+	return !PathFinder::covers(reach, site) || PathFinder::canReach(reach, site);
+}
+
+bool BuildingPlacer::isReachable(BWAPI::Unit builder, BWAPI::TilePosition position, BWAPI::UnitType type) const
+{
+	return isReachableIn(PathFinder::floodFrom(builder->getPosition()), builder, position, type);
+}
+
+BWAPI::TilePosition BuildingPlacer::getBuildLocationNear(BWAPI::TilePosition position, BWAPI::UnitType type, int buildDist, BWAPI::Unit builder) const
+{
+	//returns a valid build location near the specified tile position, and if a builder is
+	//given, one it can reach. searches outward in a spiral.
+	//one flood from the builder answers reachability for every candidate
+	PathFinder::Reach reach;
+	if (builder)
+		reach = TRACE_CALL("PathFinder::floodFrom", PathFinder::floodFrom(builder->getPosition()));
 	int x = position.x;
 	int y = position.y;
 	int length = 1;
@@ -99,7 +131,8 @@ BWAPI::TilePosition BuildingPlacer::getBuildLocationNear(BWAPI::TilePosition pos
 	{
 		//if we can build here, return this tile position
 		if (x >= 0 && x < BWAPI::Broodwar->mapWidth() && y >= 0 && y < BWAPI::Broodwar->mapHeight())
-			if (this->canBuildHereWithSpace(BWAPI::TilePosition(x, y), type, buildDist))
+			if (this->canBuildHereWithSpace(BWAPI::TilePosition(x, y), type, buildDist) &&
+				(!builder || isReachableIn(reach, builder, BWAPI::TilePosition(x, y), type)))
 				return BWAPI::TilePosition(x, y);
 
 		//otherwise, move to another position
@@ -140,7 +173,7 @@ bool BuildingPlacer::buildable(int x, int y) const
 {
 	//returns true if this tile is currently buildable, takes into account units on tile
 	if (!BWAPI::Broodwar->isBuildable(x, y)) return false;
-	for (auto &u : BWAPI::Broodwar->getUnitsOnTile(x, y))
+	for (auto &u : TRACE_CALL("getUnitsOnTile", BWAPI::Broodwar->getUnitsOnTile(x, y)))
 		if (u->getType().isBuilding() && !u->isLifted())
 			return false;
 	return true;
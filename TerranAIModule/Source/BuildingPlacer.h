@@ -12,6 +12,8 @@ public:
 	BWAPI::TilePosition getBuildLocation(BWAPI::UnitType type) const;
 	BWAPI::TilePosition getBuildLocationNear(BWAPI::TilePosition position, BWAPI::UnitType type) const;
 	BWAPI::TilePosition getBuildLocationNear(BWAPI::TilePosition position, BWAPI::UnitType type, int buildDist) const;
+	BWAPI::TilePosition getBuildLocationNear(BWAPI::Unit builder, BWAPI::UnitType type) const;
+	bool isReachable(BWAPI::Unit builder, BWAPI::TilePosition position, BWAPI::UnitType type) const;
 	bool buildable(int x, int y) const;
 	void reserveTiles(BWAPI::TilePosition position, int width, int height);
 	void freeTiles(BWAPI::TilePosition position, int width, int height);
@@ -19,6 +21,7 @@ public:
 	int getBuildDistance() const;
 	bool isReserved(int x, int y) const;
 private:
+	BWAPI::TilePosition getBuildLocationNear(BWAPI::TilePosition position, BWAPI::UnitType type, int buildDist, BWAPI::Unit builder) const;
 	Util::RectangleArray<bool> reserveMap;
 	int buildDistance;
 };
\ No newline at end of file
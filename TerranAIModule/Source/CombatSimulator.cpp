@@ -0,0 +1,389 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <memory>
+
+#include "CombatSimulator.h"
+#include "ThreadPool.h"
+#include "Trace.h"
+
+using namespace BWAPI;
+
+namespace CombatSimulator {
+
+	//a combatant's state during one scenario
+	typedef struct Fighter_t {
+		const Combatant *combatant;
+		int hitPoints;
+		int shields;
+		//position along the line between the two armies, in pixels
+		int x;
+		int cooldown;
+		//index of the enemy fighter being attacked, or -1
+		int target;
+	} Fighter;
+
+	typedef struct ScenarioOutcome_t {
+		double ourSurvivingValue;
+		double enemySurvivingValue;
+	} ScenarioOutcome;
+
+	CombatWeapon makeWeapon(WeaponType weapon, UnitType type, Player owner) {
+		CombatWeapon w;
+		w.hits = weapon == WeaponTypes::None ? 0 : weapon.damageFactor();
+		w.damage = weapon.damageAmount() + owner->getUpgradeLevel(weapon.upgradeType()) * weapon.damageBonus();
+		w.damageType = weapon.damageType();
+		w.cooldown = std::max(1, owner->weaponDamageCooldown(type));
+		w.minRange = weapon.minRange();
+		//ranges are measured edge to edge, but we only track unit centers
+		w.maxRange = owner->weaponMaxRange(weapon) + TILE_SIZE / 2;
+		w.entries = DamageMatrix::getRow(owner, weapon);
+		return w;
+	}
+
+	///<summary>Reduces a unit type to a combatant, applying the owner's upgrades.</summary>
+	Combatant makeCombatant(UnitType type, Player owner, int hitPoints, int shields) {
+		Combatant c;
+		c.type = type;
+		c.hitPoints = hitPoints * 256;
+		c.shields = shields * 256;
+		c.armor = owner->armor(type);
+		c.shieldArmor = owner->getUpgradeLevel(UpgradeTypes::Protoss_Plasma_Shields);
+		c.size = type.size();
+		c.isFlyer = type.isFlyer();
+		c.groundWeapon = makeWeapon(type.groundWeapon(), type, owner);
+		c.airWeapon = makeWeapon(type.airWeapon(), type, owner);
+		c.speed = (int)(owner->topSpeed(type) * 256);
+		c.value = type.mineralPrice() + type.gasPrice();
+		if (type.isTwoUnitsInOneEgg())
+			c.value /= 2;
+		return c;
+	}
+
+	Combatant makeCombatant(Unit unit) {
+		return makeCombatant(unit->getType(), unit->getPlayer(), unit->getHitPoints(), unit->getShields());
+	}
+
+	///<summary>Builds a combatant from what we remember of an enemy unit. Upgrades are taken
+	///from the enemy player, since we can't ask a unit we can't see who owns it.</summary>
+	Combatant makeCombatant(const EnemyMemory::EnemyRecord &record) {
+		return makeCombatant(record.type, Broodwar->enemy(), record.hitPoints, record.shields);
+	}
+
+	bool isFighter(UnitType type) {
+		return !type.isWorker() && type.canAttack();
+	}
+
+	///<summary>Returns every enemy fighting unit we believe to be alive.</summary>
+	std::vector<Combatant> getEnemyForce() {
+		std::vector<Combatant> force;
+		for (auto &r : EnemyMemory::getRecords()) {
+			if (isFighter(r.second.type))
+				force.push_back(makeCombatant(r.second));
+		}
+		return force;
+	}
+
+	///<summary>Returns the enemy fighting units last seen within the specified radius.</summary>
+	std::vector<Combatant> getEnemyForceNear(Position pos, int radius) {
+		std::vector<Combatant> force;
+		for (auto &r : EnemyMemory::getRecords()) {
+			if (isFighter(r.second.type) && r.second.positionKnown && r.second.lastPosition.getApproxDistance(pos) <= radius)
+				force.push_back(makeCombatant(r.second));
+		}
+		return force;
+	}
+
+	//xorshift; scenarios must not share random state across threads
+	unsigned int nextRandom(unsigned int &state) {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	const CombatWeapon &weaponAgainst(const Combatant &attacker, const Fighter &target) {
+		return target.combatant->isFlyer ? attacker.airWeapon : attacker.groundWeapon;
+	}
+
+	bool inRange(const CombatWeapon &w, const Fighter &attacker, const Fighter &target) {
+		int distance = std::abs(attacker.x - target.x);
+		return w.hits > 0 && distance >= w.minRange && distance <= w.maxRange;
+	}
+
+	///<summary>Deals one attack's worth of damage. Shields soak damage before armor and size
+	///are considered; what gets through is reduced as DamageMatrix::applyArmor describes.
+	///Whole hits are looked up in the damage matrix when the attacker's owner is covered by it.</summary>
+	void applyAttack(const CombatWeapon &w, Fighter &target) {
+		const Combatant &c = *target.combatant;
+		const DamageMatrix::DamageEntry *entry = w.entries ? &w.entries[c.type] : nullptr;
+		for (int hit = 0; hit < w.hits && target.hitPoints > 0; hit++) {
+			if (target.shields > 0) {
+				int toShields = entry ? entry->shieldDamage : std::max(0, (w.damage - c.shieldArmor) * 256);
+				if (toShields <= target.shields) {
+					target.shields -= toShields;
+					continue;
+				}
+				//what the shields couldn't soak still has to get through armor
+				int damage = toShields - target.shields;
+				target.shields = 0;
+				target.hitPoints -= DamageMatrix::applyArmor(damage, w.damageType, c.armor, c.size);
+				continue;
+			}
+			if (entry)
+				target.hitPoints -= entry->hitPointDamage;
+			else
+				target.hitPoints -= DamageMatrix::applyArmor(w.damage * 256, w.damageType, c.armor, c.size);
+		}
+	}
+
+	///<summary>Advances one side of the fight by a step: fighters with a target in range
+	///attack it when their weapon is ready, and the rest close in on the enemy front.</summary>
+	void stepSide(std::vector<Fighter> &side, std::vector<Fighter> &enemies, int direction, unsigned int &rng) {
+		//the closest enemy on the ground and in the air, along our direction of travel
+		int groundFront = direction > 0 ? INT_MAX : INT_MIN;
+		int airFront = groundFront;
+		for (auto &e : enemies) {
+			if (e.hitPoints <= 0)
+				continue;
+			int &front = e.combatant->isFlyer ? airFront : groundFront;
+			front = direction > 0 ? std::min(front, e.x) : std::max(front, e.x);
+		}
+
+		for (auto &f : side) {
+			if (f.hitPoints <= 0)
+				continue;
+			const Combatant &c = *f.combatant;
+			f.cooldown -= COMBAT_SIM_STEP_FRAMES;
+
+			//keep shooting at the current target while we can
+			if (f.target >= 0) {
+				Fighter &t = enemies[f.target];
+				if (t.hitPoints <= 0 || !inRange(weaponAgainst(c, t), f, t))
+					f.target = -1;
+			}
+			//otherwise pick a random enemy in range, starting the search somewhere random
+			if (f.target < 0 && !enemies.empty()) {
+				int start = nextRandom(rng) % enemies.size();
+				for (int i = 0; i < (int)enemies.size(); i++) {
+					int index = (start + i) % enemies.size();
+					Fighter &t = enemies[index];
+					if (t.hitPoints > 0 && inRange(weaponAgainst(c, t), f, t)) {
+						f.target = index;
+						break;
+					}
+				}
+			}
+
+			if (f.target >= 0) {
+				if (f.cooldown <= 0) {
+					const CombatWeapon &w = weaponAgainst(c, enemies[f.target]);
+					applyAttack(w, enemies[f.target]);
+					f.cooldown = w.cooldown;
+				}
+				continue;
+			}
+
+			//nothing in range; move toward the nearest enemy we're able to hurt
+			int front = direction > 0 ? INT_MAX : INT_MIN;
+			if (c.groundWeapon.hits > 0 && groundFront != INT_MAX && groundFront != INT_MIN)
+				front = groundFront;
+			if (c.airWeapon.hits > 0 && airFront != INT_MAX && airFront != INT_MIN &&
+				(front == INT_MAX || front == INT_MIN || std::abs(airFront - f.x) < std::abs(front - f.x)))
+				front = airFront;
+			if (front == INT_MAX || front == INT_MIN)
+				continue;
+			int step = c.speed * COMBAT_SIM_STEP_FRAMES / 256;
+			int gap = std::abs(front - f.x);
+			f.x += direction * std::min(step, gap);
+		}
+	}
+
+	double survivingValue(const std::vector<Fighter> &side) {
+		double alive = 0;
+		double total = 0;
+		for (auto &f : side) {
+			total += f.combatant->value;
+			if (f.hitPoints > 0)
+				alive += f.combatant->value * (double)f.hitPoints / std::max(1, f.combatant->hitPoints);
+		}
+		return total > 0 ? alive / total : 0.0;
+	}
+
+	bool canHurt(const std::vector<Fighter> &side, const std::vector<Fighter> &enemies) {
+		bool enemyGround = false;
+		bool enemyAir = false;
+		for (auto &e : enemies) {
+			if (e.hitPoints > 0) {
+				enemyAir |= e.combatant->isFlyer;
+				enemyGround |= !e.combatant->isFlyer;
+			}
+		}
+		for (auto &f : side) {
+			if (f.hitPoints <= 0)
+				continue;
+			if ((enemyGround && f.combatant->groundWeapon.hits > 0) || (enemyAir && f.combatant->airWeapon.hits > 0))
+				return true;
+		}
+		return false;
+	}
+
+	///<summary>Plays out one engagement. The armies start a little more than the longest
+	///range apart, with each unit placed at a random depth within its army.</summary>
+	ScenarioOutcome runScenario(const std::vector<Combatant> &ours, const std::vector<Combatant> &theirs, int scenario) {
+		unsigned int rng = 2654435761u * (unsigned int)(scenario + 1);
+
+		int longestRange = 0;
+		for (auto &c : ours)
+			longestRange = std::max(longestRange, std::max(c.groundWeapon.maxRange, c.airWeapon.maxRange));
+		for (auto &c : theirs)
+			longestRange = std::max(longestRange, std::max(c.groundWeapon.maxRange, c.airWeapon.maxRange));
+		int gap = longestRange + TILE_SIZE;
+		int depth = 6 * TILE_SIZE;
+
+		std::vector<Fighter> us;
+		std::vector<Fighter> them;
+		for (auto &c : ours) {
+			Fighter f = { &c, c.hitPoints, c.shields, -(int)(nextRandom(rng) % depth), 0, -1 };
+			us.push_back(f);
+		}
+		for (auto &c : theirs) {
+			Fighter f = { &c, c.hitPoints, c.shields, gap + (int)(nextRandom(rng) % depth), 0, -1 };
+			them.push_back(f);
+		}
+
+		for (int frame = 0; frame < COMBAT_SIM_MAX_FRAMES; frame += COMBAT_SIM_STEP_FRAMES) {
+			if (!canHurt(us, them) && !canHurt(them, us))
+				break;
+			//alternate who shoots first so neither side gets a systematic edge
+			if ((frame / COMBAT_SIM_STEP_FRAMES) % 2 == 0) {
+				stepSide(us, them, 1, rng);
+				stepSide(them, us, -1, rng);
+			}
+			else {
+				stepSide(them, us, -1, rng);
+				stepSide(us, them, 1, rng);
+			}
+		}
+
+		ScenarioOutcome outcome;
+		outcome.ourSurvivingValue = survivingValue(us);
+		outcome.enemySurvivingValue = survivingValue(them);
+		return outcome;
+	}
+
+	//everything an estimate's tasks touch. It's shared with the tasks rather than kept on the
+	//game thread's stack, so the game thread can stop waiting at the deadline and leave any
+	//scenario still running to finish into a batch nobody reads.
+	typedef struct Batch_t {
+		std::vector<Combatant> ours;
+		std::vector<Combatant> theirs;
+		//copies of the damage matrix rows the combatants use, so a rebuild can't change them mid-scenario
+		std::vector<std::vector<DamageMatrix::DamageEntry>> rows;
+		std::atomic<int> nextScenario;
+		//set when the game thread has stopped waiting; tasks start no further scenarios
+		std::atomic<bool> abandoned;
+		std::chrono::steady_clock::time_point deadline;
+		int budgetMs;
+		std::mutex doneMutex;
+		std::condition_variable allDone;
+		int running;
+		//totals over finished scenarios, guarded by doneMutex
+		int scenarios;
+		int wins;
+		double ourValue;
+		double enemyValue;
+	} Batch;
+
+	///<summary>Points a combatant's weapons at the batch's own copies of their damage matrix rows.</summary>
+	void copyRows(Batch &batch, std::vector<const DamageMatrix::DamageEntry*> &copied, CombatWeapon &w) {
+		if (!w.entries)
+			return;
+		size_t index = std::find(copied.begin(), copied.end(), w.entries) - copied.begin();
+		if (index == copied.size()) {
+			copied.push_back(w.entries);
+			batch.rows.push_back(std::vector<DamageMatrix::DamageEntry>(w.entries, w.entries + UnitTypes::Enum::MAX));
+		}
+		w.entries = &batch.rows[index][0];
+	}
+
+	void runBatch(std::shared_ptr<Batch> batch) {
+		while (!batch->abandoned && (batch->budgetMs <= 0 || std::chrono::steady_clock::now() < batch->deadline)) {
+			int scenario = batch->nextScenario++;
+			if (scenario >= COMBAT_SIM_SCENARIOS)
+				break;
+			ScenarioOutcome o = TRACE_CALL("runScenario", runScenario(batch->ours, batch->theirs, scenario));
+			std::lock_guard<std::mutex> lock(batch->doneMutex);
+			batch->scenarios++;
+			if (o.ourSurvivingValue > o.enemySurvivingValue)
+				batch->wins++;
+			batch->ourValue += o.ourSurvivingValue;
+			batch->enemyValue += o.enemySurvivingValue;
+		}
+		std::lock_guard<std::mutex> lock(batch->doneMutex);
+		batch->running--;
+		batch->allDone.notify_one();
+	}
+
+	///<summary>Estimates how a fight between the two forces would go by running randomized
+	///scenarios on the shared thread pool. Returns once COMBAT_SIM_SCENARIOS scenarios have
+	///run or the budget has elapsed, whichever comes first, counting only the scenarios
+	///finished by then; a budget of zero or less waits for every scenario.</summary>
+	CombatEstimate estimate(const std::vector<Combatant> &ours, const std::vector<Combatant> &theirs, int budgetMs) {
+		TRACE_SCOPE("CombatSimulator::estimate");
+		CombatEstimate result;
+		result.scenarios = 0;
+		result.winProbability = theirs.empty() ? 1.0 : 0.0;
+		result.ourSurvivingValue = ours.empty() ? 0.0 : 1.0;
+		result.enemySurvivingValue = theirs.empty() ? 0.0 : 1.0;
+		if (ours.empty() || theirs.empty())
+			return result;
+
+		ThreadPool &pool = ThreadPool::getShared();
+		int taskCount = pool.getThreadCount();
+
+		std::shared_ptr<Batch> batch = std::make_shared<Batch>();
+		batch->ours = ours;
+		batch->theirs = theirs;
+		std::vector<const DamageMatrix::DamageEntry*> copied;
+		for (auto &c : batch->ours) {
+			copyRows(*batch, copied, c.groundWeapon);
+			copyRows(*batch, copied, c.airWeapon);
+		}
+		for (auto &c : batch->theirs) {
+			copyRows(*batch, copied, c.groundWeapon);
+			copyRows(*batch, copied, c.airWeapon);
+		}
+		batch->nextScenario = 0;
+		batch->abandoned = false;
+		batch->budgetMs = budgetMs;
+		batch->deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(budgetMs);
+		batch->running = taskCount;
+		batch->scenarios = 0;
+		batch->wins = 0;
+		batch->ourValue = 0.0;
+		batch->enemyValue = 0.0;
+
+		for (int t = 0; t < taskCount; t++)
+			pool.enqueue([batch]() { runBatch(batch); });
+
+		{
+			std::unique_lock<std::mutex> lock(batch->doneMutex);
+			if (budgetMs <= 0)
+				batch->allDone.wait(lock, [&batch]() { return batch->running == 0; });
+			else
+				batch->allDone.wait_until(lock, batch->deadline, [&batch]() { return batch->running == 0; });
+			//tasks still queued or mid-scenario finish on their own and are ignored
+			batch->abandoned = true;
+			result.scenarios = batch->scenarios;
+			if (result.scenarios > 0) {
+				result.winProbability = (double)batch->wins / result.scenarios;
+				result.ourSurvivingValue = batch->ourValue / result.scenarios;
+				result.enemySurvivingValue = batch->enemyValue / result.scenarios;
+			}
+		}
+		return result;
+	}
+
+}
\ No newline at end of file
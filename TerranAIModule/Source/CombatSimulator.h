@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Shared.h"
+#include "EnemyMemory.h"
+#include "DamageMatrix.h"
+#include "Regression.h"
+
+//number of randomized scenarios we'd like behind each estimate
+#define COMBAT_SIM_SCENARIOS 64
+//longest the game thread will wait for an estimate, in milliseconds
+#if REGRESSION_HARNESS
+//the regression harness needs every scenario run, however fast the machine is
+#define COMBAT_SIM_BUDGET_MS 0
+#else
+#define COMBAT_SIM_BUDGET_MS 4
+#endif
+//longest engagement we simulate, in frames
+#define COMBAT_SIM_MAX_FRAMES (24 * 30)
+//frames advanced per simulation step
+#define COMBAT_SIM_STEP_FRAMES 2
+
+namespace CombatSimulator {
+
+	//a weapon with its owner's upgrades already applied
+	typedef struct CombatWeapon_t {
+		//damage per hit, before armor
+		int damage;
+		//number of hits per attack
+		int hits;
+		int damageType;
+		int cooldown;
+		int minRange;
+		int maxRange;
+		//this weapon's damage against each target type, indexed by type, or nullptr if the
+		//owner isn't covered by the damage matrix
+		const DamageMatrix::DamageEntry *entries;
+	} CombatWeapon;
+
+	//a unit reduced to the numbers that matter in a fight; contains no BWAPI handles
+	//so it can be handed to worker threads
+	typedef struct Combatant_t {
+		int type;
+		//hit points and shields are in 1/256ths, as Broodwar stores them
+		int hitPoints;
+		int shields;
+		int armor;
+		int shieldArmor;
+		int size;
+		bool isFlyer;
+		//weapons with zero hits can't be used
+		CombatWeapon groundWeapon;
+		CombatWeapon airWeapon;
+		//in 1/256ths of a pixel per frame
+		int speed;
+		//resource value, used to weigh what each side loses
+		int value;
+	} Combatant;
+
+	typedef struct CombatEstimate_t {
+		//number of scenarios that finished within the budget
+		int scenarios;
+		//fraction of scenarios in which we came out ahead
+		double winProbability;
+		//average fraction of each side's starting value still alive at the end
+		double ourSurvivingValue;
+		double enemySurvivingValue;
+	} CombatEstimate;
+
+	Combatant makeCombatant(BWAPI::UnitType type, BWAPI::Player owner, int hitPoints, int shields);
+	Combatant makeCombatant(BWAPI::Unit unit);
+	Combatant makeCombatant(const EnemyMemory::EnemyRecord &record);
+	std::vector<Combatant> getEnemyForce();
+	std::vector<Combatant> getEnemyForceNear(BWAPI::Position pos, int radius);
+	CombatEstimate estimate(const std::vector<Combatant> &ours, const std::vector<Combatant> &theirs, int budgetMs = COMBAT_SIM_BUDGET_MS);
+
+}
\ No newline at end of file
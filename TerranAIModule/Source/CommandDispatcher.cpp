@@ -0,0 +1,216 @@
+#include <deque>
+
+#include "CommandDispatcher.h"
+#include "Commandability.h"
+
+using namespace BWAPI;
+
+namespace CommandDispatcher {
+
+	//the last order we sent a unit, and when
+	typedef struct SentCommand_t {
+		UnitCommand command;
+		int frame;
+	} SentCommand;
+
+	//an order waiting to be sent to every unit in the group at once
+	typedef struct PendingGroup_t {
+		UnitCommand command;
+		Unitset units;
+	} PendingGroup;
+
+	static std::unordered_map<Unit, SentCommand> sent;
+	static std::vector<PendingGroup> pending;
+	//index into pending of the group each unit is waiting in
+	static std::unordered_map<Unit, int> pendingIndex;
+	//held orders the game refused at the last flush
+	static std::unordered_map<Unit, UnitCommand> dropped;
+	static CommandCounts current = { 0, 0, 0, 0 };
+	static CommandCounts lastFrame = { 0, 0, 0, 0 };
+	//actions issued on each flushed frame within the APM window
+	static std::deque<std::pair<int, int>> history;
+	static int historyActions = 0;
+
+	///<summary>Compares the order itself, ignoring which unit it was given to.</summary>
+	bool sameOrder(const UnitCommand &a, const UnitCommand &b) {
+		return a.type == b.type && a.target == b.target && a.x == b.x && a.y == b.y && a.extra == b.extra;
+	}
+
+	///<summary>Returns true if the game will accept the order for many units at once; orders
+	///that carry a build type, a slot or a cargo unit have to go to units one at a time.</summary>
+	bool isGroupable(const UnitCommand &command) {
+		switch (command.type) {
+		case UnitCommandTypes::Enum::Attack_Move:
+		case UnitCommandTypes::Enum::Attack_Unit:
+		case UnitCommandTypes::Enum::Move:
+		case UnitCommandTypes::Enum::Patrol:
+		case UnitCommandTypes::Enum::Hold_Position:
+		case UnitCommandTypes::Enum::Stop:
+		case UnitCommandTypes::Enum::Right_Click_Position:
+		case UnitCommandTypes::Enum::Right_Click_Unit:
+		case UnitCommandTypes::Enum::Siege:
+		case UnitCommandTypes::Enum::Unsiege:
+		case UnitCommandTypes::Enum::Use_Tech:
+		case UnitCommandTypes::Enum::Use_Tech_Position:
+		case UnitCommandTypes::Enum::Use_Tech_Unit:
+			return !command.isQueued();
+		default:
+			return false;
+		}
+	}
+
+	///<summary>Returns true if the unit was given this exact order recently enough that the
+	///game may not have acted on it yet.</summary>
+	bool isPending(Unit unit, const UnitCommand &command) {
+		auto it = sent.find(unit);
+		if (it == sent.end())
+			return false;
+		return Broodwar->getFrameCount() - it->second.frame <= Broodwar->getLatencyFrames() &&
+			sameOrder(it->second.command, command);
+	}
+
+	void recordSent(Unit unit, const UnitCommand &command) {
+		SentCommand s;
+		s.command = command;
+		s.frame = Broodwar->getFrameCount();
+		sent[unit] = s;
+	}
+
+	///<summary>Adds a unit to the group waiting on an order, taking it out of any group it
+	///was already waiting in; the latest order given to a unit wins.</summary>
+	void enqueue(Unit unit, UnitCommand command) {
+		command.unit = nullptr;
+		auto it = pendingIndex.find(unit);
+		if (it != pendingIndex.end()) {
+			if (sameOrder(pending[it->second].command, command))
+				return;
+			pending[it->second].units.erase(unit);
+		}
+		int index = -1;
+		for (int i = 0; i < (int)pending.size(); i++) {
+			if (sameOrder(pending[i].command, command)) {
+				index = i;
+				break;
+			}
+		}
+		if (index == -1) {
+			PendingGroup group;
+			group.command = command;
+			pending.push_back(group);
+			index = (int)pending.size() - 1;
+		}
+		pending[index].units.insert(unit);
+		pendingIndex[unit] = index;
+	}
+
+	///<summary>Gives a unit an order, unless it already has that order pending. Orders that
+	///can be grouped are held until flush so they can go out alongside identical orders to
+	///other units; for those, a return of true means the order was accepted, not yet sent, and
+	///wasDropped tells after the flush whether the game refused it.</summary>
+	bool issue(Unit unit, UnitCommand command) {
+		current.requested++;
+		command.unit = unit;
+		if (isPending(unit, command)) {
+			current.suppressed++;
+			return true;
+		}
+		if (isGroupable(command)) {
+			//check now, so the caller finds out and a doomed order doesn't count against the group
+			if (!Commandability::canIssue(unit, command))
+				return false;
+			enqueue(unit, command);
+			return true;
+		}
+		//the game runs the full check itself when the order is sent, so only rule out what the
+		//unit alone makes impossible
+		if (!Commandability::canIssueType(unit, command))
+			return false;
+		//an order sent now replaces whatever the unit was waiting on
+		auto it = pendingIndex.find(unit);
+		if (it != pendingIndex.end()) {
+			pending[it->second].units.erase(unit);
+			pendingIndex.erase(it);
+		}
+		if (!unit->issueCommand(command))
+			return false;
+		recordSent(unit, command);
+		current.issued++;
+		return true;
+	}
+
+	bool issue(const Unitset &units, UnitCommand command) {
+		bool accepted = false;
+		for (auto &u : units)
+			accepted |= issue(u, command);
+		return accepted;
+	}
+
+	///<summary>Sends every held order as group commands and rolls the frame's counts over.
+	///Call once at the end of each frame on which orders were given.</summary>
+	void flush() {
+		dropped.clear();
+		for (auto &group : pending) {
+			if (group.units.empty())
+				continue;
+			//the game only reports whether any unit took the order, so a group that was refused
+			//outright is the failure we can see
+			if (!Broodwar->issueCommand(group.units, group.command)) {
+				for (auto &u : group.units) {
+					dropped[u] = group.command;
+				}
+				continue;
+			}
+			for (auto &u : group.units) {
+				recordSent(u, group.command);
+			}
+			//the game orders at most one selection's worth of units per action
+			int actions = ((int)group.units.size() + COMMAND_GROUP_SIZE - 1) / COMMAND_GROUP_SIZE;
+			current.issued += actions;
+			current.coalesced += (int)group.units.size() - actions;
+		}
+		pending.clear();
+		pendingIndex.clear();
+
+		//forget orders old enough that they can no longer be pending
+		int frame = Broodwar->getFrameCount();
+		auto it = sent.begin();
+		while (it != sent.end()) {
+			if (frame - it->second.frame > Broodwar->getLatencyFrames()) {
+				it = sent.erase(it);
+				continue;
+			}
+			it++;
+		}
+
+		history.push_back(std::make_pair(frame, current.issued));
+		historyActions += current.issued;
+		while (!history.empty() && frame - history.front().first >= COMMAND_APM_WINDOW) {
+			historyActions -= history.front().second;
+			history.pop_front();
+		}
+
+		lastFrame = current;
+		current.requested = 0;
+		current.suppressed = 0;
+		current.coalesced = 0;
+		current.issued = 0;
+	}
+
+	///<summary>Returns true if this order was held for the unit and then refused by the game at
+	///the last flush, so it was never sent even though issue accepted it.</summary>
+	bool wasDropped(Unit unit, const UnitCommand &command) {
+		auto it = dropped.find(unit);
+		return it != dropped.end() && sameOrder(it->second, command);
+	}
+
+	///<summary>Returns the counts for the most recently flushed frame.</summary>
+	const CommandCounts &getFrameCounts() {
+		return lastFrame;
+	}
+
+	///<summary>Returns the actions sent to the game over the last minute of game time.</summary>
+	int getActionsPerMinute() {
+		return historyActions;
+	}
+
+}
\ No newline at end of file
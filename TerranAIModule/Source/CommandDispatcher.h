@@ -0,0 +1,32 @@
+#pragma once
+
+#include <unordered_map>
+
+#include "Shared.h"
+
+//units Broodwar can select, and so order with a single action
+#define COMMAND_GROUP_SIZE 12
+//window, in frames, over which actions per minute are measured
+#define COMMAND_APM_WINDOW (24 * 60)
+
+namespace CommandDispatcher {
+
+	typedef struct CommandCounts_t {
+		//unit orders the bot asked for
+		int requested;
+		//orders dropped because the unit already had the same order pending
+		int suppressed;
+		//unit orders that were folded into a group command
+		int coalesced;
+		//actions actually sent to the game
+		int issued;
+	} CommandCounts;
+
+	bool issue(BWAPI::Unit unit, BWAPI::UnitCommand command);
+	bool issue(const BWAPI::Unitset &units, BWAPI::UnitCommand command);
+	void flush();
+	bool wasDropped(BWAPI::Unit unit, const BWAPI::UnitCommand &command);
+	const CommandCounts &getFrameCounts();
+	int getActionsPerMinute();
+
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "Commandability.h"
+
+using namespace BWAPI;
+
+namespace Commandability {
+
+	//errors left by the game's unit-only checks made this frame, keyed by unit id * UnitCommandTypes::Enum::MAX + command type;
+	//Errors::None means the check passed
+	static std::unordered_map<int, Error> memos;
+	static int currentFrame = -1;
+	static CommandabilityCounts current = { 0, 0, 0 };
+	static CommandabilityCounts lastFrame = { 0, 0, 0 };
+
+	///<summary>Rolls the counts over on the first check of a new frame.</summary>
+	void startFrame() {
+		int frame = Broodwar->getFrameCount();
+		if (frame == currentFrame)
+			return;
+		lastFrame = current;
+		current.checks = 0;
+		current.rejectedByType = 0;
+		current.memoHits = 0;
+		currentFrame = frame;
+		//memos only hold for the frame they were made on, so the map never outgrows one frame's units
+		memos.clear();
+	}
+
+	///<summary>Returns false if no unit of the specified type could ever carry out the command.
+	///Only rules out what the unit type makes impossible; anything else is left to the game.</summary>
+	bool typeAllows(UnitType type, const UnitCommand &command) {
+		switch (command.getType()) {
+		case UnitCommandTypes::Enum::Use_Tech:
+		case UnitCommandTypes::Enum::Use_Tech_Position:
+		case UnitCommandTypes::Enum::Use_Tech_Unit:
+			//burrowing is the one tech the game lets units use without being listed as users
+			return command.getTechType() == TechTypes::Burrowing || command.getTechType().whatUses().contains(type);
+		case UnitCommandTypes::Enum::Siege:
+		case UnitCommandTypes::Enum::Unsiege:
+			return TechTypes::Tank_Siege_Mode.whatUses().contains(type);
+		case UnitCommandTypes::Enum::Train:
+			//the game also lets a few types that don't produce units train
+			return type.canProduce() || type.producesLarva() ||
+				type == UnitTypes::Terran_Nuclear_Silo || type == UnitTypes::Zerg_Hydralisk ||
+				type == UnitTypes::Zerg_Mutalisk || type == UnitTypes::Zerg_Creep_Colony ||
+				type == UnitTypes::Zerg_Spire || type == UnitTypes::Zerg_Larva;
+		case UnitCommandTypes::Enum::Gather:
+		case UnitCommandTypes::Enum::Return_Cargo:
+			return type.isWorker();
+		case UnitCommandTypes::Enum::Build_Addon:
+			return type.canBuildAddon();
+		case UnitCommandTypes::Enum::Lift:
+		case UnitCommandTypes::Enum::Land:
+			return type.isFlyingBuilding();
+		default:
+			return true;
+		}
+	}
+
+	///<summary>Returns true if the unit can be given this type of command right now, judging
+	///only by the unit itself. Type-only rejections skip the game entirely, and the game's own
+	///unit-only checks are asked at most once per unit and command type each frame. Either way
+	///the last error is left as the game would have left it, so callers can report the reason.</summary>
+	bool canIssueType(Unit unit, const UnitCommand &command) {
+		startFrame();
+		current.checks++;
+		if (!typeAllows(unit->getType(), command)) {
+			current.rejectedByType++;
+			return Broodwar->setLastError(Errors::Incompatible_UnitType);
+		}
+		int key = unit->getID() * UnitCommandTypes::Enum::MAX + command.getType();
+		auto it = memos.find(key);
+		if (it != memos.end()) {
+			current.memoHits++;
+			return Broodwar->setLastError(it->second);
+		}
+		bool result = unit->canIssueCommandType(command.getType());
+		memos.insert(std::make_pair(key, result ? Errors::None : Broodwar->getLastError()));
+		return result;
+	}
+
+	///<summary>Returns true if the game would accept the command for the unit. The unit-only
+	///part comes from canIssueType; only the checks that depend on the target are run fresh.</summary>
+	bool canIssue(Unit unit, const UnitCommand &command) {
+		if (!canIssueType(unit, command))
+			return false;
+		UnitCommand c = command;
+		c.unit = unit;
+		return unit->canIssueCommand(c, true, true, true, true, false, false);
+	}
+
+	///<summary>Returns the counts for the most recent frame on which orders were checked.</summary>
+	const CommandabilityCounts &getFrameCounts() {
+		return lastFrame;
+	}
+
+}
\ No newline at end of file
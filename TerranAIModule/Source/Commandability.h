@@ -0,0 +1,22 @@
+#pragma once
+
+#include <unordered_map>
+
+#include "Shared.h"
+
+namespace Commandability {
+
+	typedef struct CommandabilityCounts_t {
+		//orders checked
+		int checks;
+		//orders turned down on the unit's type alone, without asking the game
+		int rejectedByType;
+		//orders whose unit-only checks were answered from this frame's memo
+		int memoHits;
+	} CommandabilityCounts;
+
+	bool canIssueType(BWAPI::Unit unit, const BWAPI::UnitCommand &command);
+	bool canIssue(BWAPI::Unit unit, const BWAPI::UnitCommand &command);
+	const CommandabilityCounts &getFrameCounts();
+
+}
\ No newline at end of file
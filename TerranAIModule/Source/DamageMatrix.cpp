@@ -0,0 +1,239 @@
+#include "DamageMatrix.h"
+
+using namespace BWAPI;
+
+namespace DamageMatrix {
+
+	//percentage of damage dealt by each damage type to each unit size, after armor
+	static const int damageRatio[DamageTypes::Enum::MAX][UnitSizeTypes::Enum::MAX] = {
+		//independent, small, medium, large, none, unknown
+		{ 0, 0, 0, 0, 0, 0 },         //independent; always deals one point, handled separately
+		{ 0, 50, 75, 100, 0, 0 },     //explosive
+		{ 0, 100, 50, 25, 0, 0 },     //concussive
+		{ 0, 100, 100, 100, 0, 0 },   //normal
+		{ 0, 100, 100, 100, 0, 0 },   //ignore armor
+		{ 0, 0, 0, 0, 0, 0 },         //none
+		{ 0, 0, 0, 0, 0, 0 }          //unknown
+	};
+
+	//the damage one player deals to another's units
+	typedef struct Side_t {
+		BWAPI::Player attacker;
+		BWAPI::Player defender;
+		//upgrade levels of both players when the entries were last brought up to date
+		int attackerLevels[UpgradeTypes::Enum::MAX];
+		int defenderLevels[UpgradeTypes::Enum::MAX];
+		//one row per weapon, one entry per target type
+		std::vector<DamageEntry> entries;
+		//frames between attacks of each of the attacker's unit types
+		std::vector<int> cooldowns;
+	} Side;
+
+	//our damage to the enemy, and the enemy's damage to us
+	static Side sides[2];
+	//weapons whose damage each upgrade raises, and unit types whose armor it raises
+	static std::vector<WeaponType> weaponsByUpgrade[UpgradeTypes::Enum::MAX];
+	static std::vector<UnitType> typesByArmorUpgrade[UpgradeTypes::Enum::MAX];
+	static std::vector<UnitType> shieldedTypes;
+	static int rebuiltEntries = 0;
+
+	void initIndexes() {
+		if (!shieldedTypes.empty())
+			return;
+		for (auto &w : WeaponTypes::allWeaponTypes()) {
+			if (w.upgradeType() != UpgradeTypes::None)
+				weaponsByUpgrade[w.upgradeType()].push_back(w);
+		}
+		for (auto &t : UnitTypes::allUnitTypes()) {
+			if (t.armorUpgrade() != UpgradeTypes::None)
+				typesByArmorUpgrade[t.armorUpgrade()].push_back(t);
+			if (t.maxShields() > 0)
+				shieldedTypes.push_back(t);
+		}
+		//the one armor bonus that doesn't come from the type's armor upgrade
+		typesByArmorUpgrade[UpgradeTypes::Chitinous_Plating].push_back(UnitTypes::Zerg_Ultralisk);
+	}
+
+	///<summary>Returns the hit point damage, in 1/256ths, that the specified damage does once
+	///it gets past shields: reduced by armor, scaled by damage type versus unit size, and never
+	///less than half a point.</summary>
+	int applyArmor(int damage, int damageType, int armor, int size) {
+		if (damageType == DamageTypes::Enum::Independent)
+			return 256;
+		if (damageType != DamageTypes::Enum::Ignore_Armor)
+			damage -= armor * 256;
+		return std::max(damage * damageRatio[damageType][size] / 100, 128);
+	}
+
+	///<summary>Works out one entry from scratch. Shields only subtract shield armor; the rest
+	///follows applyArmor.</summary>
+	void buildEntry(Side &side, WeaponType weapon, UnitType target) {
+		DamageEntry &e = side.entries[weapon * UnitTypes::Enum::MAX + target];
+		if (weapon == WeaponTypes::None || weapon == WeaponTypes::Unknown) {
+			e.hitPointDamage = 0;
+			e.shieldDamage = 0;
+			rebuiltEntries++;
+			return;
+		}
+		int damage = weapon.damageAmount() + side.attackerLevels[weapon.upgradeType()] * weapon.damageBonus();
+		e.shieldDamage = std::max(0, damage - side.defenderLevels[UpgradeTypes::Enum::Protoss_Plasma_Shields]) * 256;
+		e.hitPointDamage = applyArmor(damage * 256, weapon.damageType(), side.defender->armor(target), target.size());
+		rebuiltEntries++;
+	}
+
+	void buildRow(Side &side, WeaponType weapon) {
+		for (auto &t : UnitTypes::allUnitTypes())
+			buildEntry(side, weapon, t);
+	}
+
+	void buildColumn(Side &side, UnitType target) {
+		for (auto &w : WeaponTypes::allWeaponTypes())
+			buildEntry(side, w, target);
+	}
+
+	void buildCooldowns(Side &side) {
+		for (auto &t : UnitTypes::allUnitTypes())
+			side.cooldowns[t] = std::max(1, side.attacker->weaponDamageCooldown(t));
+	}
+
+	void readLevels(Player player, int *levels) {
+		std::fill(levels, levels + UpgradeTypes::Enum::MAX, 0);
+		for (auto &u : UpgradeTypes::allUpgradeTypes())
+			levels[u] = player->getUpgradeLevel(u);
+	}
+
+	void buildSide(Side &side, Player attacker, Player defender) {
+		side.attacker = attacker;
+		side.defender = defender;
+		readLevels(attacker, side.attackerLevels);
+		readLevels(defender, side.defenderLevels);
+		side.entries.resize(WeaponTypes::Enum::MAX * UnitTypes::Enum::MAX);
+		side.cooldowns.resize(UnitTypes::Enum::MAX);
+		for (auto &w : WeaponTypes::allWeaponTypes())
+			buildRow(side, w);
+		buildCooldowns(side);
+	}
+
+	///<summary>Rebuilds only what changed since the last update: the rows of weapons an
+	///attacker upgrade improved, and the columns of target types a defender upgrade armored.</summary>
+	void updateSide(Side &side) {
+		bool attackerChanged = false;
+		for (auto &u : UpgradeTypes::allUpgradeTypes()) {
+			int level = side.attacker->getUpgradeLevel(u);
+			if (level != side.attackerLevels[u]) {
+				side.attackerLevels[u] = level;
+				attackerChanged = true;
+				for (auto &w : weaponsByUpgrade[u])
+					buildRow(side, w);
+			}
+			level = side.defender->getUpgradeLevel(u);
+			if (level != side.defenderLevels[u]) {
+				side.defenderLevels[u] = level;
+				for (auto &t : typesByArmorUpgrade[u])
+					buildColumn(side, t);
+				if (u == UpgradeTypes::Protoss_Plasma_Shields) {
+					for (auto &t : shieldedTypes)
+						buildColumn(side, t);
+				}
+			}
+		}
+		//attack speed upgrades are rare and there's no index of who they affect, so ask again
+		if (attackerChanged)
+			buildCooldowns(side);
+	}
+
+	///<summary>Brings the matrix up to date with both players' upgrades. Cheap when nothing
+	///changed; call once per frame before anything reads the matrix.</summary>
+	void update() {
+		initIndexes();
+		rebuiltEntries = 0;
+		Player players[2] = { Broodwar->self(), Broodwar->enemy() };
+		for (int i = 0; i < 2; i++) {
+			Side &side = sides[i];
+			Player attacker = players[i];
+			Player defender = players[1 - i];
+			if (side.attacker != attacker || side.defender != defender || side.entries.empty())
+				buildSide(side, attacker, defender);
+			else
+				updateSide(side);
+		}
+	}
+
+	void clear() {
+		for (auto &side : sides) {
+			side.attacker = nullptr;
+			side.defender = nullptr;
+			side.entries.clear();
+			side.cooldowns.clear();
+		}
+	}
+
+	Side *getSide(Player attacker) {
+		for (auto &side : sides) {
+			if (side.attacker == attacker && !side.entries.empty())
+				return &side;
+		}
+		return nullptr;
+	}
+
+	///<summary>Returns the entries for every target type of the specified weapon, indexed by
+	///target type, or nullptr if the attacker is neither us nor the enemy.</summary>
+	const DamageEntry *getRow(Player attacker, WeaponType weapon) {
+		Side *side = getSide(attacker);
+		if (!side)
+			return nullptr;
+		return &side->entries[weapon * UnitTypes::Enum::MAX];
+	}
+
+	const DamageEntry *getEntry(Player attacker, WeaponType weapon, UnitType target) {
+		const DamageEntry *row = getRow(attacker, weapon);
+		return row ? &row[target] : nullptr;
+	}
+
+	int getCooldown(Player attacker, UnitType attackerType) {
+		Side *side = getSide(attacker);
+		return side ? side->cooldowns[attackerType] : std::max(1, attacker->weaponDamageCooldown(attackerType));
+	}
+
+	WeaponType weaponAgainst(UnitType attackerType, UnitType target) {
+		return target.isFlyer() ? attackerType.airWeapon() : attackerType.groundWeapon();
+	}
+
+	///<summary>Returns the hit point damage per second the attacker deals to a target with
+	///no shields left, or zero if it can't attack the target at all.</summary>
+	double getDamagePerSecond(Player attacker, UnitType attackerType, UnitType target) {
+		WeaponType weapon = weaponAgainst(attackerType, target);
+		const DamageEntry *e = getEntry(attacker, weapon, target);
+		if (!e)
+			return 0.0;
+		double perAttack = e->hitPointDamage / 256.0 * weapon.damageFactor();
+		return perAttack * DAMAGE_MATRIX_FRAMES_PER_SECOND / getCooldown(attacker, attackerType);
+	}
+
+	///<summary>Returns the frames a single attacker needs to kill a target with the specified
+	///hit points and shields, counted from its first attack, or DAMAGE_MATRIX_NEVER. Damage
+	///that spills over from the last shield hit into hit points is ignored.</summary>
+	int getFramesToKill(Player attacker, UnitType attackerType, UnitType target, int hitPoints, int shields) {
+		WeaponType weapon = weaponAgainst(attackerType, target);
+		const DamageEntry *e = getEntry(attacker, weapon, target);
+		int hits = weapon.damageFactor();
+		if (!e || hits <= 0 || e->hitPointDamage <= 0)
+			return DAMAGE_MATRIX_NEVER;
+		int attacks = 0;
+		if (shields > 0) {
+			if (e->shieldDamage <= 0)
+				return DAMAGE_MATRIX_NEVER;
+			int perAttack = e->shieldDamage * hits;
+			attacks += (shields * 256 + perAttack - 1) / perAttack;
+		}
+		int perAttack = e->hitPointDamage * hits;
+		attacks += (hitPoints * 256 + perAttack - 1) / perAttack;
+		return std::max(0, attacks - 1) * getCooldown(attacker, attackerType);
+	}
+
+	///<summary>Returns the number of entries recomputed by the last update.</summary>
+	int getRebuiltEntries() {
+		return rebuiltEntries;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Shared.h"
+
+//game frames per second at the fastest game speed
+#define DAMAGE_MATRIX_FRAMES_PER_SECOND 24
+//returned by getFramesToKill when the attacker can't kill the target
+#define DAMAGE_MATRIX_NEVER -1
+
+namespace DamageMatrix {
+
+	//what a single hit from one weapon does to one target type, with the upgrades of both
+	//the attacker and the target's owner applied
+	typedef struct DamageEntry_t {
+		//damage to hit points once shields are down, in 1/256ths
+		int hitPointDamage;
+		//damage to shields, in 1/256ths
+		int shieldDamage;
+	} DamageEntry;
+
+	int applyArmor(int damage, int damageType, int armor, int size);
+	void update();
+	void clear();
+	const DamageEntry *getRow(BWAPI::Player attacker, BWAPI::WeaponType weapon);
+	const DamageEntry *getEntry(BWAPI::Player attacker, BWAPI::WeaponType weapon, BWAPI::UnitType target);
+	int getCooldown(BWAPI::Player attacker, BWAPI::UnitType attackerType);
+	double getDamagePerSecond(BWAPI::Player attacker, BWAPI::UnitType attackerType, BWAPI::UnitType target);
+	int getFramesToKill(BWAPI::Player attacker, BWAPI::UnitType attackerType, BWAPI::UnitType target, int hitPoints, int shields);
+	int getRebuiltEntries();
+
+}
\ No newline at end of file
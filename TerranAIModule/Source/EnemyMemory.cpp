@@ -0,0 +1,218 @@
+#include "EnemyMemory.h"
+
+using namespace BWAPI;
+
+namespace EnemyMemory {
+
+	static std::unordered_map<int, EnemyRecord> records;
+	//number of enemy units of each type that we believe to be alive
+	static int unitCounts[UnitTypes::Enum::MAX];
+	//army value of every enemy unit we believe to be alive, positioned or not
+	static int totalArmyValue = 0;
+	//army value of the enemy units last seen in each cell, row-major
+	static std::vector<int> cellValues;
+	static int gridWidth = 0;
+	static int gridHeight = 0;
+
+	void initGrid() {
+		if (!cellValues.empty())
+			return;
+		gridWidth = (Broodwar->mapWidth() + ENEMY_MEMORY_CELL_TILES - 1) / ENEMY_MEMORY_CELL_TILES;
+		gridHeight = (Broodwar->mapHeight() + ENEMY_MEMORY_CELL_TILES - 1) / ENEMY_MEMORY_CELL_TILES;
+		cellValues.assign(gridWidth * gridHeight, 0);
+	}
+
+	int cellOf(Position pos) {
+		if (!pos.isValid())
+			return -1;
+		int x = std::min(pos.x / (ENEMY_MEMORY_CELL_TILES * TILE_SIZE), gridWidth - 1);
+		int y = std::min(pos.y / (ENEMY_MEMORY_CELL_TILES * TILE_SIZE), gridHeight - 1);
+		return y * gridWidth + x;
+	}
+
+	///<summary>Returns the resource value of a unit type if it contributes to the enemy's
+	///fighting strength, or zero if it doesn't.</summary>
+	int armyValueOf(UnitType type) {
+		if (type.isWorker())
+			return 0;
+		if (!type.canAttack() && !type.isSpellcaster() && type != UnitTypes::Terran_Bunker)
+			return 0;
+		int value = type.mineralPrice() + type.gasPrice();
+		//zerglings and scourge are priced per pair
+		if (type.isTwoUnitsInOneEgg())
+			value /= 2;
+		return value;
+	}
+
+	///<summary>Moves a record's contribution in the army value grid to match its current state.</summary>
+	void place(EnemyRecord &r) {
+		int cell = r.positionKnown ? cellOf(r.lastPosition) : -1;
+		int value = armyValueOf(r.type);
+		if (cell == r.cell && value == r.value)
+			return;
+		if (r.cell >= 0)
+			cellValues[r.cell] -= r.value;
+		if (cell >= 0)
+			cellValues[cell] += value;
+		r.cell = cell;
+		r.value = value;
+	}
+
+	void setType(EnemyRecord &r, UnitType type) {
+		if (r.type == type)
+			return;
+		unitCounts[r.type]--;
+		totalArmyValue -= armyValueOf(r.type);
+		r.type = type;
+		unitCounts[r.type]++;
+		totalArmyValue += armyValueOf(r.type);
+	}
+
+	///<summary>Copies the current state of a visible unit into its record.</summary>
+	void refresh(EnemyRecord &r, Unit unit) {
+		setType(r, unit->getType());
+		r.unit = unit;
+		r.lastPosition = unit->getPosition();
+		r.lastSeenFrame = Broodwar->getFrameCount();
+		r.hitPoints = unit->getHitPoints();
+		r.shields = unit->getShields();
+		r.isBuilding = r.type.isBuilding();
+		r.isCloaked = unit->isCloaked() || unit->isBurrowed();
+		r.visible = true;
+		r.positionKnown = true;
+		place(r);
+	}
+
+	std::unordered_map<int, EnemyRecord>::iterator forget(std::unordered_map<int, EnemyRecord>::iterator it) {
+		EnemyRecord &r = it->second;
+		r.positionKnown = false;
+		place(r);
+		unitCounts[r.type]--;
+		totalArmyValue -= armyValueOf(r.type);
+		return records.erase(it);
+	}
+
+	bool isEnemy(Unit unit) {
+		return unit->getPlayer() && unit->getPlayer()->isEnemy(Broodwar->self());
+	}
+
+	///<summary>Records a unit that has just become visible.</summary>
+	void onUnitShow(Unit unit) {
+		if (!isEnemy(unit))
+			return;
+		initGrid();
+		auto it = records.find(unit->getID());
+		if (it == records.end()) {
+			EnemyRecord r;
+			r.type = unit->getType();
+			r.cell = -1;
+			r.value = 0;
+			unitCounts[r.type]++;
+			totalArmyValue += armyValueOf(r.type);
+			it = records.insert(std::make_pair(unit->getID(), r)).first;
+		}
+		refresh(it->second, unit);
+	}
+
+	///<summary>Records where a unit was as it becomes invisible.</summary>
+	void onUnitHide(Unit unit) {
+		auto it = records.find(unit->getID());
+		if (it == records.end())
+			return;
+		if (unit->isVisible())
+			refresh(it->second, unit);
+		it->second.visible = false;
+	}
+
+	void onUnitDestroy(Unit unit) {
+		auto it = records.find(unit->getID());
+		if (it != records.end())
+			forget(it);
+	}
+
+	void onUnitMorph(Unit unit) {
+		auto it = records.find(unit->getID());
+		if (it == records.end())
+			onUnitShow(unit);
+		else if (unit->isVisible())
+			refresh(it->second, unit);
+	}
+
+	///<summary>Refreshes the records of visible enemy units and decays records that have
+	///gone stale. Buildings are forgotten entirely once we can see where they stood and they
+	///are gone. Moving units lose their position after ENEMY_MEMORY_DECAY_FRAMES; seeing the
+	///spot empty tells us nothing, since a unit that walks out of sight was last seen at the
+	///edge of our vision.</summary>
+	void update() {
+		initGrid();
+		for (auto &player : Broodwar->enemies()) {
+			for (auto &u : player->getUnits()) {
+				auto it = records.find(u->getID());
+				if (it == records.end())
+					onUnitShow(u);
+				else
+					refresh(it->second, u);
+			}
+		}
+
+		int frame = Broodwar->getFrameCount();
+		auto it = records.begin();
+		while (it != records.end()) {
+			EnemyRecord &r = it->second;
+			if (r.visible && !r.unit->isVisible())
+				r.visible = false;
+			if (r.visible || !r.positionKnown) {
+				it++;
+				continue;
+			}
+			//we're looking right at where it stood and it isn't there (unless it's hiding from us)
+			if (r.isBuilding && !r.isCloaked && Broodwar->isVisible(TilePosition(r.lastPosition))) {
+				it = forget(it);
+				continue;
+			}
+			if (!r.isBuilding && frame - r.lastSeenFrame > ENEMY_MEMORY_DECAY_FRAMES) {
+				r.positionKnown = false;
+				place(r);
+			}
+			it++;
+		}
+	}
+
+	///<summary>Returns the number of enemy units of the specified type that we believe to be alive.</summary>
+	int getUnitCount(UnitType type) {
+		return unitCounts[type];
+	}
+
+	///<summary>Returns the combined value of every enemy fighting unit we believe to be alive.</summary>
+	int getArmyValue() {
+		return totalArmyValue;
+	}
+
+	///<summary>Returns the combined value of enemy fighting units last seen in the grid cells
+	///overlapping the square of the specified radius around pos. Cost is proportional to the
+	///number of cells covered, not the number of enemies.</summary>
+	int getArmyValueNear(Position pos, int radius) {
+		if (cellValues.empty())
+			return 0;
+		int cellSize = ENEMY_MEMORY_CELL_TILES * TILE_SIZE;
+		int left = std::max(0, (pos.x - radius) / cellSize);
+		int top = std::max(0, (pos.y - radius) / cellSize);
+		int right = std::min(gridWidth - 1, (pos.x + radius) / cellSize);
+		int bottom = std::min(gridHeight - 1, (pos.y + radius) / cellSize);
+		int value = 0;
+		for (int y = top; y <= bottom; y++)
+			for (int x = left; x <= right; x++)
+				value += cellValues[y * gridWidth + x];
+		return value;
+	}
+
+	const EnemyRecord *getRecord(Unit unit) {
+		auto it = records.find(unit->getID());
+		return it == records.end() ? nullptr : &it->second;
+	}
+
+	const std::unordered_map<int, EnemyRecord> &getRecords() {
+		return records;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <unordered_map>
+
+#include "Shared.h"
+
+//frames after which we stop trusting the last known position of an enemy unit that can move
+#define ENEMY_MEMORY_DECAY_FRAMES (24 * 60)
+//width and height, in tiles, of a cell in the enemy army value grid
+#define ENEMY_MEMORY_CELL_TILES 8
+
+namespace EnemyMemory {
+
+	//everything we remember about an enemy unit, whether or not we can currently see it
+	typedef struct EnemyRecord_t {
+		//the unit itself; only safe to query while visible is true
+		BWAPI::Unit unit;
+		BWAPI::UnitType type;
+		BWAPI::Position lastPosition;
+		//frame on which we last saw the unit
+		int lastSeenFrame;
+		int hitPoints;
+		int shields;
+		bool isBuilding;
+		//whether the unit was cloaked or burrowed when we last saw it
+		bool isCloaked;
+		//whether the unit is currently visible to us
+		bool visible;
+		//whether lastPosition is still believed to be accurate
+		bool positionKnown;
+		//army value grid cell this record contributes to, or -1
+		int cell;
+		//value this record contributes to the army value grid
+		int value;
+	} EnemyRecord;
+
+	void onUnitShow(BWAPI::Unit unit);
+	void onUnitHide(BWAPI::Unit unit);
+	void onUnitDestroy(BWAPI::Unit unit);
+	void onUnitMorph(BWAPI::Unit unit);
+	void update();
+	int getUnitCount(BWAPI::UnitType type);
+	int getArmyValue();
+	int getArmyValueNear(BWAPI::Position pos, int radius);
+	const EnemyRecord *getRecord(BWAPI::Unit unit);
+	const std::unordered_map<int, EnemyRecord> &getRecords();
+
+}
\ No newline at end of file
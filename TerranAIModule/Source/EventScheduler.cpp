@@ -0,0 +1,139 @@
+#include <deque>
+
+#include "EventScheduler.h"
+
+using namespace BWAPI;
+
+namespace EventScheduler {
+
+	//a scheduled callback; entries are pooled and never move, so callbacks can live inside them
+	typedef struct Entry_t {
+		Callback callback;
+		//first frame on which the callback no longer runs
+		int expiryFrame;
+		//neighbours in the list of active entries, or -1
+		int prev;
+		int next;
+		//next entry in the same wheel slot, or -1
+		int nextInSlot;
+	} Entry;
+
+	static std::deque<Entry> entries;
+	static std::vector<int> freeEntries;
+	//entries due to expire on a frame that maps to each slot, possibly some turns of the wheel later
+	static int wheel[EVENT_WHEEL_SLOTS];
+	static bool wheelReady = false;
+	static int activeHead = -1;
+	static int activeTail = -1;
+	static int activeCount = 0;
+	//last frame whose wheel slot has been processed
+	static int lastFrame = -1;
+
+	void initWheel() {
+		if (wheelReady)
+			return;
+		for (int i = 0; i < EVENT_WHEEL_SLOTS; i++)
+			wheel[i] = -1;
+		wheelReady = true;
+	}
+
+	void unlink(int index) {
+		Entry &e = entries[index];
+		if (e.prev != -1)
+			entries[e.prev].next = e.next;
+		else
+			activeHead = e.next;
+		if (e.next != -1)
+			entries[e.next].prev = e.prev;
+		else
+			activeTail = e.prev;
+		e.callback.reset();
+		freeEntries.push_back(index);
+		activeCount--;
+	}
+
+	///<summary>Takes an entry from the pool, adds it to the end of the active list and files
+	///it under the wheel slot of its expiry frame. The caller fills in the callback.</summary>
+	Callback &allocateCallback(int frames) {
+		initWheel();
+		int index;
+		if (freeEntries.empty()) {
+			entries.emplace_back();
+			index = (int)entries.size() - 1;
+		}
+		else {
+			index = freeEntries.back();
+			freeEntries.pop_back();
+		}
+		Entry &e = entries[index];
+		e.expiryFrame = Broodwar->getFrameCount() + std::max(frames, 0) + 1;
+		e.prev = activeTail;
+		e.next = -1;
+		if (activeTail != -1)
+			entries[activeTail].next = index;
+		else
+			activeHead = index;
+		activeTail = index;
+		int &slot = wheel[e.expiryFrame & (EVENT_WHEEL_SLOTS - 1)];
+		e.nextInSlot = slot;
+		slot = index;
+		activeCount++;
+		return e.callback;
+	}
+
+	///<summary>Retires the entries filed under the slot of the specified frame whose time
+	///is up, keeping the ones due on a later turn of the wheel.</summary>
+	void retireSlot(int frame) {
+		int &slot = wheel[frame & (EVENT_WHEEL_SLOTS - 1)];
+		int keep = -1;
+		int index = slot;
+		while (index != -1) {
+			int next = entries[index].nextInSlot;
+			if (entries[index].expiryFrame <= frame) {
+				unlink(index);
+			}
+			else {
+				entries[index].nextInSlot = keep;
+				keep = index;
+			}
+			index = next;
+		}
+		slot = keep;
+	}
+
+	///<summary>Retires expired callbacks and runs the rest. Call every frame, before the bot
+	///decides anything, so callbacks scheduled this frame first run on the next.</summary>
+	void update() {
+		initWheel();
+		int frame = Broodwar->getFrameCount();
+		if (lastFrame < 0)
+			lastFrame = frame - 1;
+		//catch up on any frames we weren't called for; a full turn visits every slot
+		int from = std::max(lastFrame + 1, frame - EVENT_WHEEL_SLOTS + 1);
+		for (int f = from; f <= frame; f++)
+			retireSlot(f);
+		lastFrame = std::max(lastFrame, frame);
+
+		int index = activeHead;
+		while (index != -1) {
+			int next = entries[index].next;
+			entries[index].callback();
+			index = next;
+		}
+	}
+
+	///<summary>Drops every scheduled callback.</summary>
+	void clear() {
+		while (activeHead != -1)
+			unlink(activeHead);
+		for (int i = 0; i < EVENT_WHEEL_SLOTS; i++)
+			wheel[i] = -1;
+		wheelReady = true;
+		lastFrame = -1;
+	}
+
+	int getActiveCount() {
+		return activeCount;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <new>
+#include <type_traits>
+
+#include "Shared.h"
+
+//frames covered by one turn of the timer wheel; must be a power of two
+#define EVENT_WHEEL_SLOTS 256
+//callables up to this size are stored inside the pooled entry instead of on the heap
+#define EVENT_CALLBACK_BYTES 48
+
+namespace EventScheduler {
+
+	//a type-erased callable that lives inside its owner unless it's too big to fit
+	class Callback {
+	public:
+		Callback() : invoker(nullptr), destroyer(nullptr) {}
+		~Callback() { reset(); }
+
+		template <class F>
+		void assign(F action) {
+			reset();
+			store(action, std::integral_constant<bool, sizeof(F) <= EVENT_CALLBACK_BYTES>());
+		}
+		void operator()() { invoker(&storage); }
+		void reset() {
+			if (destroyer)
+				destroyer(&storage);
+			invoker = nullptr;
+			destroyer = nullptr;
+		}
+	private:
+		Callback(const Callback&);
+		Callback &operator=(const Callback&);
+
+		template <class F>
+		static void invokeInline(void *p) { (*static_cast<F*>(p))(); }
+		template <class F>
+		static void destroyInline(void *p) { static_cast<F*>(p)->~F(); }
+		template <class F>
+		static void invokeHeap(void *p) { (**static_cast<F**>(p))(); }
+		template <class F>
+		static void destroyHeap(void *p) { delete *static_cast<F**>(p); }
+
+		template <class F>
+		void store(F &action, std::true_type) {
+			new (&storage) F(action);
+			invoker = &invokeInline<F>;
+			destroyer = &destroyInline<F>;
+		}
+		template <class F>
+		void store(F &action, std::false_type) {
+			*reinterpret_cast<F**>(&storage) = new F(action);
+			invoker = &invokeHeap<F>;
+			destroyer = &destroyHeap<F>;
+		}
+
+		std::aligned_storage<EVENT_CALLBACK_BYTES, 8>::type storage;
+		void (*invoker)(void*);
+		void (*destroyer)(void*);
+	};
+
+	Callback &allocateCallback(int frames);
+	void update();
+	void clear();
+	int getActiveCount();
+
+	///<summary>Runs the action once per frame for the specified number of frames, starting
+	///next frame. Takes the place of Broodwar->registerEvent for per-frame drawing.</summary>
+	template <class F>
+	void schedule(F action, int frames) {
+		allocateCallback(frames).assign(action);
+	}
+
+}
\ No newline at end of file
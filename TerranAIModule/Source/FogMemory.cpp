@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <tuple>
+
+#include "FogMemory.h"
+
+using namespace BWAPI;
+
+namespace FogMemory {
+
+	//running totals for one search region, over its walkable tiles only
+	typedef struct Region_t {
+		int walkableTiles;
+		//tiles visible as of their row's last scan
+		int visibleTiles;
+		//sum of the last seen frames of the tiles that aren't visible
+		long long hiddenLastSeen;
+	} Region;
+
+	static int mapWidth = 0;
+	static int mapHeight = 0;
+	static int wordsPerRow = 0;
+	//one bit per tile, set if the tile was visible when its row was last scanned, row-major
+	static std::vector<unsigned int> visibleWords;
+	//frame on which each tile was last visible; only kept up to date while it isn't
+	static std::vector<int> lastSeen;
+	static std::vector<bool> walkable;
+	//frame on which each row was last scanned
+	static std::vector<int> rowScanFrame;
+	static std::vector<Region> regions;
+	static int regionsWide = 0;
+	static int regionsHigh = 0;
+	static int nextRow = 0;
+
+	int regionOf(int x, int y) {
+		return (y / FOG_MEMORY_REGION_TILES) * regionsWide + x / FOG_MEMORY_REGION_TILES;
+	}
+
+	void init() {
+		if (!lastSeen.empty())
+			return;
+		mapWidth = Broodwar->mapWidth();
+		mapHeight = Broodwar->mapHeight();
+		wordsPerRow = (mapWidth + 31) / 32;
+		visibleWords.assign(wordsPerRow * mapHeight, 0);
+		lastSeen.assign(mapWidth * mapHeight, FOG_MEMORY_NEVER_SEEN);
+		rowScanFrame.assign(mapHeight, 0);
+		regionsWide = (mapWidth + FOG_MEMORY_REGION_TILES - 1) / FOG_MEMORY_REGION_TILES;
+		regionsHigh = (mapHeight + FOG_MEMORY_REGION_TILES - 1) / FOG_MEMORY_REGION_TILES;
+		Region empty = { 0, 0, 0 };
+		regions.assign(regionsWide * regionsHigh, empty);
+
+		//a tile is worth searching if a unit can stand anywhere on it
+		walkable.assign(mapWidth * mapHeight, false);
+		for (int y = 0; y < mapHeight; y++) {
+			for (int x = 0; x < mapWidth; x++) {
+				bool any = false;
+				for (int i = 0; i < 16 && !any; i++)
+					any = Broodwar->isWalkable(x * 4 + i % 4, y * 4 + i / 4);
+				if (!any)
+					continue;
+				walkable[y * mapWidth + x] = true;
+				Region &r = regions[regionOf(x, y)];
+				r.walkableTiles++;
+				r.hiddenLastSeen += FOG_MEMORY_NEVER_SEEN;
+			}
+		}
+	}
+
+	///<summary>Reads one row's visibility and applies whatever changed since the row was last
+	///scanned. Rows are compared 32 tiles at a time, so a row nobody can see costs one
+	///comparison per word.</summary>
+	void scanRow(int y, int frame) {
+		for (int w = 0; w < wordsPerRow; w++) {
+			int first = w * 32;
+			int last = std::min(first + 32, mapWidth);
+			unsigned int bits = 0;
+			for (int x = first; x < last; x++) {
+				if (Broodwar->isVisible(x, y))
+					bits |= 1u << (x - first);
+			}
+			unsigned int &old = visibleWords[y * wordsPerRow + w];
+			unsigned int changed = old ^ bits;
+			if (!changed)
+				continue;
+			for (int b = 0; b < 32; b++) {
+				if (!(changed & (1u << b)))
+					continue;
+				int x = first + b;
+				int tile = y * mapWidth + x;
+				bool nowVisible = (bits & (1u << b)) != 0;
+				//it was still in view when the row was last scanned
+				if (!nowVisible)
+					lastSeen[tile] = rowScanFrame[y];
+				if (!walkable[tile])
+					continue;
+				Region &r = regions[regionOf(x, y)];
+				if (nowVisible) {
+					r.visibleTiles++;
+					r.hiddenLastSeen -= lastSeen[tile];
+				}
+				else {
+					r.visibleTiles--;
+					r.hiddenLastSeen += lastSeen[tile];
+				}
+			}
+			old = bits;
+		}
+		rowScanFrame[y] = frame;
+	}
+
+	///<summary>Scans the next FOG_MEMORY_ROWS_PER_FRAME rows. Call every frame.</summary>
+	void update() {
+		init();
+		int frame = Broodwar->getFrameCount();
+		int rows = std::min(FOG_MEMORY_ROWS_PER_FRAME, mapHeight);
+		for (int i = 0; i < rows; i++) {
+			scanRow(nextRow, frame);
+			nextRow = (nextRow + 1) % mapHeight;
+		}
+	}
+
+	void clear() {
+		visibleWords.clear();
+		lastSeen.clear();
+		walkable.clear();
+		rowScanFrame.clear();
+		regions.clear();
+		nextRow = 0;
+	}
+
+	int lastSeenOf(int x, int y, int frame) {
+		if (visibleWords[y * wordsPerRow + x / 32] & (1u << (x % 32)))
+			return frame;
+		return lastSeen[y * mapWidth + x];
+	}
+
+	///<summary>Returns the frame on which the tile was last visible, the current frame if it's
+	///visible now, or FOG_MEMORY_NEVER_SEEN.</summary>
+	int getLastSeenFrame(TilePosition tile) {
+		if (lastSeen.empty() || !tile.isValid())
+			return FOG_MEMORY_NEVER_SEEN;
+		return lastSeenOf(tile.x, tile.y, Broodwar->getFrameCount());
+	}
+
+	///<summary>Returns the centre of the least recently seen walkable tile in the rectangle,
+	///preferring tiles closer to pos, or Positions::None if it has none.</summary>
+	Position oldestTileIn(int left, int top, int right, int bottom, Position pos, int radius) {
+		int frame = Broodwar->getFrameCount();
+		TilePosition center(pos);
+		int radiusTiles = radius / TILE_SIZE;
+		Position best = Positions::None;
+		int bestSeen = 0;
+		int bestDistance = 0;
+		for (int y = std::max(top, 0); y <= std::min(bottom, mapHeight - 1); y++) {
+			for (int x = std::max(left, 0); x <= std::min(right, mapWidth - 1); x++) {
+				if (!walkable[y * mapWidth + x])
+					continue;
+				int dx = x - center.x;
+				int dy = y - center.y;
+				int distance = dx * dx + dy * dy;
+				if (radius > 0 && distance > radiusTiles * radiusTiles)
+					continue;
+				int seen = lastSeenOf(x, y, frame);
+				if (best == Positions::None || seen < bestSeen || (seen == bestSeen && distance < bestDistance)) {
+					best = Position(TilePosition(x, y)) + Position(TILE_SIZE / 2, TILE_SIZE / 2);
+					bestSeen = seen;
+					bestDistance = distance;
+				}
+			}
+		}
+		return best;
+	}
+
+	///<summary>Returns the least recently seen walkable tile within the radius, in pixels, of
+	///pos, or Positions::None if there's no walkable tile there.</summary>
+	Position getOldestTileNear(Position pos, int radius) {
+		if (lastSeen.empty() || !pos.isValid())
+			return Positions::None;
+		TilePosition center(pos);
+		int radiusTiles = radius / TILE_SIZE;
+		return oldestTileIn(center.x - radiusTiles, center.y - radiusTiles, center.x + radiusTiles, center.y + radiusTiles, pos, radius);
+	}
+
+	///<summary>Finds the region whose walkable tiles were, on average, seen longest ago and that
+	///a ground unit at from can reach, and returns its oldest tile. Regions containing a
+	///position in avoid are skipped, so several searchers can be sent to different regions.
+	///Closer regions win ties. Returns Positions::None if every region is skipped.</summary>
+	Position getStalestRegion(Position from, const std::vector<Position> &avoid) {
+		if (lastSeen.empty())
+			return Positions::None;
+		int frame = Broodwar->getFrameCount();
+
+		//candidates as (average last seen frame, squared distance in regions, region)
+		std::vector<std::tuple<double, int, int>> candidates;
+		TilePosition fromTile(from);
+		for (int ry = 0; ry < regionsHigh; ry++) {
+			for (int rx = 0; rx < regionsWide; rx++) {
+				int index = ry * regionsWide + rx;
+				const Region &r = regions[index];
+				if (r.walkableTiles == 0)
+					continue;
+				bool avoided = false;
+				for (auto &p : avoid) {
+					if (p.isValid() && regionOf(p.x / TILE_SIZE, p.y / TILE_SIZE) == index)
+						avoided = true;
+				}
+				if (avoided)
+					continue;
+				double averageSeen = (r.hiddenLastSeen + (double)r.visibleTiles * frame) / r.walkableTiles;
+				int dx = rx - fromTile.x / FOG_MEMORY_REGION_TILES;
+				int dy = ry - fromTile.y / FOG_MEMORY_REGION_TILES;
+				candidates.push_back(std::make_tuple(averageSeen, dx * dx + dy * dy, index));
+			}
+		}
+		std::sort(candidates.begin(), candidates.end());
+
+		//if from itself is somewhere nothing can path from, fall back to the stalest region
+		Position fallback = Positions::None;
+		for (auto &c : candidates) {
+			int index = std::get<2>(c);
+			int left = (index % regionsWide) * FOG_MEMORY_REGION_TILES;
+			int top = (index / regionsWide) * FOG_MEMORY_REGION_TILES;
+			Position target = oldestTileIn(left, top, left + FOG_MEMORY_REGION_TILES - 1, top + FOG_MEMORY_REGION_TILES - 1, from, 0);
+			if (target == Positions::None)
+				continue;
+			if (!from.isValid() || Broodwar->hasPath(from, target))
+				return target;
+			if (fallback == Positions::None)
+				fallback = target;
+		}
+		return fallback;
+	}
+
+}
\ No newline at end of file
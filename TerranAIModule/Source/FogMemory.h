@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Shared.h"
+
+//rows of tiles whose visibility is read each frame; the whole map is covered every
+//mapHeight / FOG_MEMORY_ROWS_PER_FRAME frames
+#define FOG_MEMORY_ROWS_PER_FRAME 32
+//width and height, in tiles, of a search region
+#define FOG_MEMORY_REGION_TILES 16
+//returned by getLastSeenFrame for tiles we have never seen
+#define FOG_MEMORY_NEVER_SEEN -1
+
+namespace FogMemory {
+
+	void update();
+	void clear();
+	int getLastSeenFrame(BWAPI::TilePosition tile);
+	BWAPI::Position getStalestRegion(BWAPI::Position from, const std::vector<BWAPI::Position> &avoid = std::vector<BWAPI::Position>());
+	BWAPI::Position getOldestTileNear(BWAPI::Position pos, int radius);
+
+}
\ No newline at end of file
@@ -1,5 +1,14 @@
 #include "MilitaryManager.h"
 #include "UnitBehavior.h"
+#include "BuildOrderSimulator.h"
+#include "EnemyMemory.h"
+#include "Squads.h"
+#include "CombatSimulator.h"
+#include "CommandDispatcher.h"
+#include "Trace.h"
+#include "FogMemory.h"
+#include "RegionGraph.h"
+#include "Prediction.h"
 
 using namespace BWAPI;
 
@@ -8,7 +17,6 @@ namespace MilitaryManager {
 	static Position rallyPoint;
 	static bool obeyRallyPoint = true;
 	static std::vector<MilitaryUnit> army;
-	static std::vector<Unit> enemyUnits;
 	static Tactic tactic;
 	static Position enemyBase;
 	static bool attacking = false;
@@ -26,13 +34,18 @@ namespace MilitaryManager {
 
 	void setRallyPoint(Position pos) {
 		rallyPoint = pos;
+		//the rally point overrides whatever the squads were doing
+		for (auto &squad : Squads::getSquads()) {
+			squad.objective = pos;
+		}
 	}
 
 	Position getRallyPoint() {
 		return rallyPoint;
 	}
 
-	///<summary>Removes units that no longer exist from the army</summary>
+	///<summary>Removes units that no longer exist from the army and regroups the
+	///units that are not reserved for another task into squads</summary>
 	void validateUnits() {
 		std::vector<MilitaryUnit>::iterator i = army.begin();
 		while (i != army.end()) {
@@ -43,33 +56,50 @@ namespace MilitaryManager {
 			}
 			i++;
 		}
+
+		Unitset available;
+		for (auto &mu : army) {
+			if (!mu.reserved)
+				available.insert(mu.unit);
+		}
+		Squads::update(available);
+		//squads that just formed head for the rally point until told otherwise
+		for (auto &squad : Squads::getSquads()) {
+			if (squad.objective == Positions::None)
+				squad.objective = rallyPoint;
+		}
 	}
 
-	///<summary>Orders all military units that are not reserved for another task
-	///to attack-move to the current rally point.</summary>
+	///<summary>Orders each squad to attack-move to its objective, which is the current
+	///rally point unless the squad has been given something better to do. Units already
+	///on their way are left alone, and the rest of each squad is moved with one grouped order.</summary>
 	void moveToRally() {
 		if (!obeyRallyPoint)
 			return;
-		for (auto &mu : army) {
-			if (!mu.reserved) {
-				//check if we're already attack-moving to the rally point or have an independent move order; if so, don't reissue the order
-				if (!(mu.unit->getOrder() == Orders::AttackMove || mu.unit->getOrder() == Orders::Move)
-					|| mu.unit->getOrderTargetPosition().getDistance(rallyPoint) > 4 * TILE_SIZE) {
-					//check that we're not already in close proximity to the rally point or attacking something
-					if (mu.unit->getPosition().getDistance(rallyPoint) > 5 * TILE_SIZE || mu.unit->isAttacking()) {
-						mu.unit->attack(rallyPoint);
-					} //not close to rally
-				} //not moving to rally
-			} //not reserved
-		} //MilitaryUnit iterator
+		for (auto &squad : Squads::getSquads()) {
+			Position objective = squad.objective;
+			Unitset stragglers;
+			for (auto &u : squad.units) {
+				//check if we're already attack-moving to the objective or have an independent move order; if so, don't reissue the order
+				if (!(u->getOrder() == Orders::AttackMove || u->getOrder() == Orders::Move)
+					|| u->getOrderTargetPosition().getDistance(objective) > 4 * TILE_SIZE) {
+					//check that we're not already in close proximity to the objective or attacking something
+					if (u->getPosition().getDistance(objective) > 5 * TILE_SIZE || u->isAttacking()) {
+						stragglers.insert(u);
+					} //not close to objective
+				} //not moving to objective
+			} //squad member iterator
+			if (!stragglers.empty())
+				CommandDispatcher::issue(stragglers, UnitCommand::attack(nullptr, objective));
+		} //squad iterator
 	}
 
 	bool getUnitsGathered() {
 		double muPercent = 0.0;
-		for (auto &mu : army) {
-			//if the unit is within 10 tiles of the rallyPoint, add 1 to muPercent
-			if (mu.unit->getPosition().getDistance(rallyPoint) <= 10 * TILE_SIZE){
-				muPercent++;
+		for (auto &squad : Squads::getSquads()) {
+			//if the squad is within 10 tiles of the rallyPoint, add its size to muPercent
+			if (squad.centroid.getDistance(rallyPoint) <= 10 * TILE_SIZE){
+				muPercent += squad.units.size();
 			}
 		}
 		//if the value stored in muPercent is >= 75% of the army size, 
@@ -78,18 +108,27 @@ namespace MilitaryManager {
 			Broodwar << "Gathered " << muPercent << " of " << army.size() << " units" <<std::endl; //for debugging purposes
 			return true;
 		}
-		else{
-			return false;
-		}
-	}
 
-	int countEnemyUnitsOfType(UnitType type) {
-		int count = 0;
-		for (auto *u : enemyUnits) {
-			if (u->getType() == type)
-				count++;
+		//don't wait for stragglers if the units already gathered would win the fight on their own;
+		//like evaluatePreparedness, only re-simulate every PREPAREDNESS_INTERVAL frames
+		static int gracePeriod = 0;
+		static CombatSimulator::CombatEstimate outcome = { 0, 0.0, 0.0, 0.0 };
+		if (Broodwar->getFrameCount() >= gracePeriod) {
+			gracePeriod = Broodwar->getFrameCount() + PREPAREDNESS_INTERVAL;
+			std::vector<CombatSimulator::Combatant> gathered;
+			for (auto &squad : Squads::getSquads()) {
+				if (squad.centroid.getDistance(rallyPoint) <= 10 * TILE_SIZE) {
+					for (auto &u : squad.units)
+						gathered.push_back(CombatSimulator::makeCombatant(u));
+				}
+			}
+			outcome = CombatSimulator::estimate(gathered, CombatSimulator::getEnemyForce());
 		}
-		return count;
+		if (outcome.scenarios > 0 && outcome.winProbability >= EARLY_ATTACK_WIN_PROBABILITY) {
+			Broodwar << "Gathered " << muPercent << " of " << army.size() << " units, enough to win" << std::endl;
+			return true;
+		}
+		return false;
 	}
 
 	void evaluateStrategy() {
@@ -107,25 +146,30 @@ namespace MilitaryManager {
 			zergstr;
 		Broodwar << "We've found the enemy. We're against " << str << std::endl;
 
+		std::vector<UnitBehavior::Goal> plan;
 		if (enemyRace == Races::Zerg) {
 			//against zerg, add an extra barracks and get stim for a quick bust
-			UnitBehavior::addGoal(UnitTypes::Terran_Barracks);
-			UnitBehavior::addGoal(TechTypes::Stim_Packs);
+			plan.push_back(UnitBehavior::makeGoal(UnitTypes::Terran_Barracks));
+			plan.push_back(UnitBehavior::makeGoal(TechTypes::Stim_Packs));
 			//and a comsat station so we can deal with lurkers
-			UnitBehavior::addGoal(UnitTypes::Terran_Comsat_Station);
+			plan.push_back(UnitBehavior::makeGoal(UnitTypes::Terran_Comsat_Station));
 		}
 
 		if (enemyRace == Races::Protoss || enemyRace == Races::Terran) {
 			//add more siege tank production against protoss and terran
-			UnitBehavior::addGoal(UnitTypes::Terran_Machine_Shop);
+			plan.push_back(UnitBehavior::makeGoal(UnitTypes::Terran_Machine_Shop));
 		}
 
 		if (enemyRace == Races::Protoss) {
-			UnitBehavior::addGoal(UnitTypes::Terran_Comsat_Station);
+			plan.push_back(UnitBehavior::makeGoal(UnitTypes::Terran_Comsat_Station));
 		}
 		//add an extra barracks to the end of each build to help us make use of excess mineral income
-		UnitBehavior::addGoal(UnitTypes::Terran_Barracks);
-		
+		plan.push_back(UnitBehavior::makeGoal(UnitTypes::Terran_Barracks));
+
+		//let the simulator pick the order in which these goals finish soonest
+		for (auto &g : BuildOrderSimulator::findBestOrdering(BuildOrderSimulator::getCurrentState(), plan)) {
+			UnitBehavior::addGoal(g);
+		}
 	}
 
 	void evaluateScoutingInfo(Position enemyBaseLoc) {
@@ -135,31 +179,27 @@ namespace MilitaryManager {
 		//we're concerned mainly about the number of basic units the enemy has built
 		Race enemyRace = Broodwar->enemy()->getRace();
 		Broodwar << "Found enemy townhall." << std::endl;
-		if ((enemyRace == Races::Terran && countEnemyUnitsOfType(UnitTypes::Terran_Marine) >= 4) ||
-			(enemyRace == Races::Zerg && countEnemyUnitsOfType(UnitTypes::Zerg_Zergling) >= 4) ||
-			(enemyRace == Races::Protoss && countEnemyUnitsOfType(UnitTypes::Protoss_Zealot) >= 2))
+		std::vector<UnitBehavior::Goal> plan;
+		if ((enemyRace == Races::Terran && EnemyMemory::getUnitCount(UnitTypes::Terran_Marine) >= 4) ||
+			(enemyRace == Races::Zerg && EnemyMemory::getUnitCount(UnitTypes::Zerg_Zergling) >= 4) ||
+			(enemyRace == Races::Protoss && EnemyMemory::getUnitCount(UnitTypes::Protoss_Zealot) >= 2))
 		{
 			//if we're getting rushed, build a couple of bunkers ASAP
-			UnitBehavior::addGoal(UnitTypes::Terran_Bunker, true, 2);
+			plan.push_back(UnitBehavior::makeGoal(UnitTypes::Terran_Bunker));
+			plan.push_back(UnitBehavior::makeGoal(UnitTypes::Terran_Bunker));
 		}
 
-		if (enemyRace == Races::Protoss && countEnemyUnitsOfType(UnitTypes::Protoss_Citadel_of_Adun) > 0) {
+		if (enemyRace == Races::Protoss && EnemyMemory::getUnitCount(UnitTypes::Protoss_Citadel_of_Adun) > 0) {
 			//decent chance we're getting DT rushed; spam detection
-			UnitBehavior::addGoal(UnitTypes::Terran_Missile_Turret, true, 2);
+			plan.push_back(UnitBehavior::makeGoal(UnitTypes::Terran_Missile_Turret));
+			plan.push_back(UnitBehavior::makeGoal(UnitTypes::Terran_Missile_Turret));
 		}
-	}
 
-	void indexEnemyUnit(Unit unit) {
-		//if we haven't seen this enemy unit before, add it to the list
-		bool haveSeen = false;
-		for (auto &u : enemyUnits) {
-			if (unit == u) {
-				haveSeen = true;
-				break;
-			}
+		//these jump the queue, so push them to the front in reverse of the simulated order
+		std::vector<UnitBehavior::Goal> ordered = BuildOrderSimulator::findBestOrdering(BuildOrderSimulator::getCurrentState(), plan);
+		for (auto g = ordered.rbegin(); g != ordered.rend(); g++) {
+			UnitBehavior::addGoal(*g, true);
 		}
-		if (!haveSeen)
-			enemyUnits.push_back(unit);
 	}
 
 	void setTactic(Tactic newTactic) {
@@ -199,22 +239,29 @@ namespace MilitaryManager {
 			for (auto &u : Broodwar->self()->getUnits()) {
 				if (u->getType() == UnitTypes::Terran_Bunker) {
 					if (u->getLoadedUnits().size() < 4) {
+						//fill the bunker with the marines that will be closest to it once they get the order
+						std::vector<std::pair<int, MilitaryUnit*>> candidates;
 						for (auto &mu : army) {
-							if (getLoaderAllocatedUnitCount(u) < 4) {
-								if (mu.unit->getType() == UnitTypes::Terran_Marine &&
-									!mu.reserved) {
-									//prevent our marine from receiving further orders
-									mu.reserved = true;
-									mu.loader = u;
-									//issue the load order
-									u->load(mu.unit);
-								} //military unit is marine and is not reserved
-							} //fewer than 4 units allocated to the bunker
+							if (mu.unit->getType() == UnitTypes::Terran_Marine &&
+								!mu.reserved) {
+								Position predicted = Prediction::predictPosition(mu.unit, Prediction::getCommandDelay());
+								candidates.push_back(std::make_pair(predicted.getApproxDistance(u->getPosition()), &mu));
+							} //military unit is marine and is not reserved
 						} //military unit iterator
+						std::sort(candidates.begin(), candidates.end(), [](const std::pair<int, MilitaryUnit*> &a, const std::pair<int, MilitaryUnit*> &b) { return a.first < b.first; });
+						for (auto &candidate : candidates) {
+							if (getLoaderAllocatedUnitCount(u) >= 4)
+								break;
+							//prevent our marine from receiving further orders
+							candidate.second->reserved = true;
+							candidate.second->loader = u;
+							//issue the load order
+							CommandDispatcher::issue(u, UnitCommand::load(u, candidate.second->unit));
+						} //candidate iterator
 						for (auto &mu : army) {
 							if (mu.loader == u) {
 								if (mu.unit->getOrder() != Orders::EnterTransport || mu.unit->getOrderTarget() != u) {
-									u->load(mu.unit);
+									CommandDispatcher::issue(u, UnitCommand::load(u, mu.unit));
 								} //unit is not attempting to enter the bunker
 							} //unit should be loaded into the bunker
 						} //military unit iterator
@@ -223,7 +270,7 @@ namespace MilitaryManager {
 			} //unit iterator
 
 			//if there are enemies threatening our base, attack them
-			Unitset nearbyEnemies = townhall->getUnitsInRadius(32 * TILE_SIZE, Filter::IsEnemy);
+			Unitset nearbyEnemies = TRACE_CALL("getUnitsInRadius", townhall->getUnitsInRadius(32 * TILE_SIZE, Filter::IsEnemy));
 			if (nearbyEnemies.size() > 0) {
 				setRallyPoint(nearbyEnemies.getPosition());
 			} //we're being attacked
@@ -249,6 +296,12 @@ namespace MilitaryManager {
 
 			if (attacking && target) { //if we're attacking and we can see an enemy unit, go kill it
 				setRallyPoint(target->getPosition());
+				//each squad goes after whichever enemy is closest to it, aiming where it'll be when the order arrives
+				for (auto &squad : Squads::getSquads()) {
+					Unit closest = TRACE_CALL("getClosestUnit", Broodwar->getClosestUnit(squad.centroid, Filter::IsEnemy));
+					if (closest)
+						squad.objective = Prediction::predictPosition(closest, Prediction::getCommandDelay());
+				}
 				return;
 			}
 
@@ -257,12 +310,18 @@ namespace MilitaryManager {
 			//we have a target and we're not already planning an attack
 			if (target && !planningAttack) {
 				//set our rally point to the midpoint of the average of our units' positions and the target's position and wait til our units gather
-				Unitset a;
-				for (auto &mu : army) {
-					a.insert(mu.unit);
-				}
 				enemyLocation = target->getPosition();
-				setRallyPoint((a.getPosition() + enemyLocation) / 2);
+				Position armyPosition = Squads::getCentroid();
+				Position gatherPoint = enemyLocation;
+				if (armyPosition) {
+					//halfway along the route our units will actually walk; the straight-line midpoint can be up a cliff
+					int groundDistance = RegionGraph::getGroundDistance(armyPosition, enemyLocation);
+					if (groundDistance != REGION_GRAPH_UNREACHABLE)
+						gatherPoint = RegionGraph::getPointAlongPath(armyPosition, enemyLocation, groundDistance / 2);
+					else
+						gatherPoint = (armyPosition + enemyLocation) / 2;
+				}
+				setRallyPoint(gatherPoint);
 				gatheringPeriod = Broodwar->getFrameCount() + (24 * 60); //timeout so we don't get stuck gathering forever
 
 				obeyRallyPoint = true;
@@ -272,8 +331,8 @@ namespace MilitaryManager {
 			else if (planningAttack && (getUnitsGathered() || Broodwar->getFrameCount() > gatheringPeriod)) { //we're planning an attack and our units are ready, or the gathering period has expired
 				//let slip the dogs of war
 				setRallyPoint(enemyLocation);
-				for (auto &mu : army) {
-					mu.unit->attack(enemyLocation);
+				for (auto &squad : Squads::getSquads()) {
+					CommandDispatcher::issue(squad.units, UnitCommand::attack(nullptr, enemyLocation));
 				}
 				//let them go for a while before we reevaluate
 				gracePeriod = Broodwar->getFrameCount() + (24 * 10);
@@ -283,9 +342,26 @@ namespace MilitaryManager {
 				attacking = true;
 			}
 			else if (!planningAttack) { //we have no target and we're not planning an attack - spread out and search for the enemy
-				for (auto &mu : army) {
-					if (mu.unit->isIdle())
-						mu.unit->attack(Helpers::getRandomPosition());
+				//each squad searches as a group, sending its idle units to the area we've gone longest
+				//without seeing, and staying out of the areas the other squads are searching
+				std::vector<Position> searched;
+				for (auto &squad : Squads::getSquads()) {
+					if (squad.objective != Positions::None)
+						searched.push_back(squad.objective);
+				}
+				for (auto &squad : Squads::getSquads()) {
+					Unitset idle;
+					for (auto &u : squad.units) {
+						if (u->isIdle())
+							idle.insert(u);
+					}
+					if (!idle.empty()) {
+						squad.objective = TRACE_CALL("FogMemory::getStalestRegion", FogMemory::getStalestRegion(squad.centroid, searched));
+						if (squad.objective == Positions::None)
+							squad.objective = Helpers::getRandomPosition();
+						searched.push_back(squad.objective);
+						CommandDispatcher::issue(idle, UnitCommand::attack(nullptr, squad.objective));
+					}
 				}
 				obeyRallyPoint = false;
 			}
@@ -294,7 +370,7 @@ namespace MilitaryManager {
 				if (mu.loader) {
 					if (mu.loader->getType() == UnitTypes::Terran_Bunker) {
 						if (mu.unit->isLoaded()) {
-							mu.loader->unload(mu.unit);
+							CommandDispatcher::issue(mu.loader, UnitCommand::unload(mu.loader, mu.unit));
 						} //is loaded
 						mu.loader = nullptr;
 						mu.reserved = false;
@@ -307,11 +383,39 @@ namespace MilitaryManager {
 	void MilitaryManager::evaluatePreparedness() {
 		if (!Broodwar->enemy())
 			return;
-		Race enemyRace = Broodwar->enemy()->getRace();
-		//if we have 4+ siege tanks
-		if (Helpers::getOwnedUnitCountOfType(UnitTypes::Terran_Siege_Tank_Tank_Mode) >= 4 ||
-			attacking) //or we're currently attacking
-		{
+		//simulating the fight isn't free, so only reconsider it every couple of seconds
+		static int gracePeriod = 0;
+		static CombatSimulator::CombatEstimate outcome = { 0, 0.0, 0.0, 0.0 };
+		if (Broodwar->getFrameCount() >= gracePeriod) {
+			gracePeriod = Broodwar->getFrameCount() + PREPAREDNESS_INTERVAL;
+			std::vector<CombatSimulator::Combatant> ours;
+			for (auto &squad : Squads::getSquads()) {
+				for (auto &u : squad.units)
+					ours.push_back(CombatSimulator::makeCombatant(u));
+			}
+			outcome = CombatSimulator::estimate(ours, CombatSimulator::getEnemyForce());
+		}
+		//without anything seen of the enemy army, the simulation can't tell us anything
+		bool informed = outcome.scenarios > 0 && EnemyMemory::getArmyValue() > 0;
+
+		if (attacking) {
+			//keep pressing the attack unless the fight has turned against us
+			if (informed && outcome.winProbability < RETREAT_WIN_PROBABILITY) {
+				Broodwar << "Calling off the attack." << std::endl;
+				attacking = false;
+				setTactic(Tactic::DEFEND);
+				return;
+			}
+			setTactic(Tactic::ATTACK);
+			return;
+		}
+
+		//if we have 4+ siege tanks and don't expect to lose, or we expect to crush the enemy anyway
+		bool tanksReady = Helpers::getOwnedUnitCountOfType(UnitTypes::Terran_Siege_Tank_Tank_Mode) >= 4 &&
+			(!informed || outcome.winProbability >= ATTACK_WIN_PROBABILITY);
+		bool overwhelming = informed && outcome.winProbability >= EARLY_ATTACK_WIN_PROBABILITY &&
+			Squads::getUnitCount() >= EARLY_ATTACK_MIN_UNITS;
+		if (tanksReady || overwhelming) {
 			setTactic(Tactic::ATTACK);
 			return;
 		}
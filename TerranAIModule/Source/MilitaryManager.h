@@ -2,6 +2,17 @@
 
 #include "Shared.h"
 
+//how often, in frames, we re-simulate the fight against the enemy army
+#define PREPAREDNESS_INTERVAL 48
+//win probability needed to attack before our tanks are ready
+#define EARLY_ATTACK_WIN_PROBABILITY 0.9
+//army size needed to attack before our tanks are ready
+#define EARLY_ATTACK_MIN_UNITS 8
+//win probability below which we hold off on attacking, even with our tanks ready
+#define ATTACK_WIN_PROBABILITY 0.5
+//win probability below which an attack in progress is called off
+#define RETREAT_WIN_PROBABILITY 0.25
+
 namespace MilitaryManager {
 
 	enum MilitaryUnitTask {
@@ -22,7 +33,6 @@ namespace MilitaryManager {
 	void moveToRally();
 	void evaluateStrategy();
 	void evaluateScoutingInfo(BWAPI::Position enemyBaseLoc);
-	void indexEnemyUnit(BWAPI::Unit unit);
 	void setTactic(Tactic newTactic);
 	Tactic getTactic();
 	void executeTactic();
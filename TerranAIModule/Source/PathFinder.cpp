@@ -0,0 +1,560 @@
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <queue>
+#include <unordered_map>
+
+#include "PathFinder.h"
+#include "ThreadPool.h"
+#include "Trace.h"
+#include "EnemyMemory.h"
+
+using namespace BWAPI;
+
+namespace PathFinder {
+
+	//cost of a straight and a diagonal step between walk tiles, in tenths of a walk tile
+	static const int straightCost = 10;
+	static const int diagonalCost = 14;
+
+	//one search's bookkeeping for every walk tile. Entries are only valid where their stamp
+	//matches the search's generation, so nothing needs clearing between searches.
+	typedef struct SearchState_t {
+		std::vector<int> cost;
+		std::vector<int> parent;
+		std::vector<unsigned int> seen;
+		std::vector<unsigned int> closed;
+		unsigned int generation;
+	} SearchState;
+
+	typedef struct CacheEntry_t {
+		unsigned long long key;
+		Path path;
+		//walk tiles the path passes over, for deciding whether a new building cuts it
+		int left, top, right, bottom;
+	} CacheEntry;
+
+	typedef struct Request_t {
+		Position from;
+		Position to;
+		std::function<void(const Path&)> callback;
+		Path path;
+	} Request;
+
+	//a footprint, in walk tiles, that appeared since the grid was last rebuilt
+	typedef struct Footprint_t {
+		int left, top, right, bottom;
+	} Footprint;
+
+	static int width = 0;
+	static int height = 0;
+	//terrain walkability of each walk tile, row-major
+	static std::vector<bool> walkable;
+	//walkable and not under a building; the only grid searches read
+	static std::vector<bool> open;
+
+	static std::list<CacheEntry> cache;
+	static std::unordered_map<unsigned long long, std::list<CacheEntry>::iterator> cacheIndex;
+
+	static std::vector<Footprint> newFootprints;
+	static bool buildingDestroyed = false;
+
+	static std::vector<Request> queued;
+	//requests being searched on the thread pool; the grid mustn't change until they're done
+	static std::vector<Request> inFlight;
+	//requests answered from the cache, delivered on the next update
+	static std::vector<Request> ready;
+	static int running = 0;
+	static std::mutex runningMutex;
+	static std::condition_variable allDone;
+
+	//created on first use and joined in clear
+	static std::unique_ptr<ThreadPool> searchPool;
+
+	//search states not in use; each thread searching needs its own
+	static std::vector<std::unique_ptr<SearchState>> freeStates;
+	static std::mutex statesMutex;
+
+	bool isOpen(int x, int y) {
+		return x >= 0 && y >= 0 && x < width && y < height && open[y * width + x];
+	}
+
+	void blockFootprint(UnitType type, Position pos) {
+		int left = std::max(0, (pos.x - type.dimensionLeft()) / 8);
+		int top = std::max(0, (pos.y - type.dimensionUp()) / 8);
+		int right = std::min(width - 1, (pos.x + type.dimensionRight()) / 8);
+		int bottom = std::min(height - 1, (pos.y + type.dimensionDown()) / 8);
+		for (int y = top; y <= bottom; y++) {
+			for (int x = left; x <= right; x++)
+				open[y * width + x] = false;
+		}
+	}
+
+	///<summary>Marks the walk tiles under every building we know of as blocked: the ones we can
+	///see, and enemy buildings where we last saw them. Buildings in the air don't block
+	///anything.</summary>
+	void rebuildOpen() {
+		open = walkable;
+		auto block = [](Unit u) {
+			UnitType type = u->getType();
+			if (!(type.isBuilding() || type.isMineralField() || type == UnitTypes::Resource_Vespene_Geyser) || u->isLifted())
+				return;
+			blockFootprint(type, u->getPosition());
+		};
+		for (auto &u : Broodwar->getAllUnits())
+			block(u);
+		for (auto &u : Broodwar->getStaticNeutralUnits())
+			block(u);
+		for (auto &entry : EnemyMemory::getRecords()) {
+			const EnemyMemory::EnemyRecord &r = entry.second;
+			if (r.isBuilding && !r.visible && r.positionKnown && r.lastPosition.isValid())
+				blockFootprint(r.type, r.lastPosition);
+		}
+	}
+
+	void init() {
+		if (!walkable.empty())
+			return;
+		width = Broodwar->mapWidth() * 4;
+		height = Broodwar->mapHeight() * 4;
+		walkable.assign(width * height, false);
+		for (int y = 0; y < height; y++) {
+			for (int x = 0; x < width; x++)
+				walkable[y * width + x] = Broodwar->isWalkable(x, y);
+		}
+		rebuildOpen();
+	}
+
+	///<summary>Brings the grid up to date with buildings that have appeared or gone, and drops
+	///the cached paths that may have changed: those crossing a new building, or every path if a
+	///building is gone, since that can open a shortcut anywhere. Only safe with no searches
+	///running.</summary>
+	void applyBuildingChanges() {
+		if (newFootprints.empty() && !buildingDestroyed)
+			return;
+		rebuildOpen();
+		auto it = cache.begin();
+		while (it != cache.end()) {
+			bool stale = buildingDestroyed;
+			for (auto &f : newFootprints) {
+				if (f.left <= it->right && f.right >= it->left && f.top <= it->bottom && f.bottom >= it->top)
+					stale = true;
+			}
+			if (stale) {
+				cacheIndex.erase(it->key);
+				it = cache.erase(it);
+			}
+			else
+				it++;
+		}
+		newFootprints.clear();
+		buildingDestroyed = false;
+	}
+
+	std::unique_ptr<SearchState> takeState() {
+		std::lock_guard<std::mutex> lock(statesMutex);
+		if (freeStates.empty()) {
+			std::unique_ptr<SearchState> state(new SearchState());
+			state->cost.resize(width * height);
+			state->parent.resize(width * height);
+			state->seen.assign(width * height, 0);
+			state->closed.assign(width * height, 0);
+			state->generation = 0;
+			return state;
+		}
+		std::unique_ptr<SearchState> state = std::move(freeStates.back());
+		freeStates.pop_back();
+		return state;
+	}
+
+	void returnState(std::unique_ptr<SearchState> state) {
+		std::lock_guard<std::mutex> lock(statesMutex);
+		freeStates.push_back(std::move(state));
+	}
+
+	int octile(int dx, int dy) {
+		dx = std::abs(dx);
+		dy = std::abs(dy);
+		return diagonalCost * std::min(dx, dy) + straightCost * (std::max(dx, dy) - std::min(dx, dy));
+	}
+
+	int sign(int v) {
+		return (v > 0) - (v < 0);
+	}
+
+	///<summary>Moves from (x, y) in the specified direction until it reaches the goal, a tile
+	///with a neighbour that can only be reached optimally through it, or a wall. Returns that
+	///tile's index, or -1 for a wall. Units can't cut corners, so a diagonal step needs both of
+	///the tiles beside it open.</summary>
+	int jump(int x, int y, int dx, int dy, int goalX, int goalY) {
+		while (true) {
+			if (!isOpen(x, y))
+				return -1;
+			if (x == goalX && y == goalY)
+				return y * width + x;
+			if (dx != 0 && dy != 0) {
+				if (jump(x + dx, y, dx, 0, goalX, goalY) >= 0 || jump(x, y + dy, 0, dy, goalX, goalY) >= 0)
+					return y * width + x;
+			}
+			else if (dx != 0) {
+				if ((isOpen(x, y - 1) && !isOpen(x - dx, y - 1)) || (isOpen(x, y + 1) && !isOpen(x - dx, y + 1)))
+					return y * width + x;
+			}
+			else {
+				if ((isOpen(x - 1, y) && !isOpen(x - 1, y - dy)) || (isOpen(x + 1, y) && !isOpen(x + 1, y - dy)))
+					return y * width + x;
+			}
+			if (!isOpen(x + dx, y) || !isOpen(x, y + dy))
+				return -1;
+			x += dx;
+			y += dy;
+		}
+	}
+
+	///<summary>Lists the directions worth searching from a tile reached by moving (dx, dy): the
+	///natural neighbours of that move plus any forced by walls. A tile with no parent tries all
+	///eight.</summary>
+	void directionsFrom(int x, int y, int dx, int dy, std::vector<std::pair<int, int>> &directions) {
+		directions.clear();
+		if (dx == 0 && dy == 0) {
+			for (int ddy = -1; ddy <= 1; ddy++) {
+				for (int ddx = -1; ddx <= 1; ddx++) {
+					if ((ddx || ddy) && (!ddx || !ddy || (isOpen(x + ddx, y) && isOpen(x, y + ddy))))
+						directions.push_back(std::make_pair(ddx, ddy));
+				}
+			}
+			return;
+		}
+		if (dx != 0 && dy != 0) {
+			if (isOpen(x, y + dy))
+				directions.push_back(std::make_pair(0, dy));
+			if (isOpen(x + dx, y))
+				directions.push_back(std::make_pair(dx, 0));
+			if (isOpen(x, y + dy) && isOpen(x + dx, y))
+				directions.push_back(std::make_pair(dx, dy));
+		}
+		else if (dx != 0) {
+			bool up = isOpen(x, y - 1);
+			bool down = isOpen(x, y + 1);
+			if (isOpen(x + dx, y)) {
+				directions.push_back(std::make_pair(dx, 0));
+				if (up)
+					directions.push_back(std::make_pair(dx, -1));
+				if (down)
+					directions.push_back(std::make_pair(dx, 1));
+			}
+			if (up)
+				directions.push_back(std::make_pair(0, -1));
+			if (down)
+				directions.push_back(std::make_pair(0, 1));
+		}
+		else {
+			bool left = isOpen(x - 1, y);
+			bool right = isOpen(x + 1, y);
+			if (isOpen(x, y + dy)) {
+				directions.push_back(std::make_pair(0, dy));
+				if (left)
+					directions.push_back(std::make_pair(-1, dy));
+				if (right)
+					directions.push_back(std::make_pair(1, dy));
+			}
+			if (left)
+				directions.push_back(std::make_pair(-1, 0));
+			if (right)
+				directions.push_back(std::make_pair(1, 0));
+		}
+	}
+
+	///<summary>Finds the shortest path between two walk tiles with jump point search, which only
+	///puts the tiles where a path could turn on the open list. Reads the grid but never changes
+	///it, so searches can run on several threads at once.</summary>
+	Path search(Position from, Position to, SearchState &s) {
+		Path path;
+		path.found = false;
+		path.length = 0;
+		int startX = from.x / 8, startY = from.y / 8;
+		int goalX = to.x / 8, goalY = to.y / 8;
+		//the start can be under the unit's own building or a footprint edge; only the goal must be open
+		if (!isOpen(goalX, goalY))
+			return path;
+		int start = startY * width + startX;
+		int goal = goalY * width + goalX;
+
+		s.generation++;
+		s.cost[start] = 0;
+		s.parent[start] = start;
+		s.seen[start] = s.generation;
+		std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> openList;
+		openList.push(std::make_pair(octile(goalX - startX, goalY - startY), start));
+		std::vector<std::pair<int, int>> directions;
+		while (!openList.empty()) {
+			int node = openList.top().second;
+			openList.pop();
+			if (s.closed[node] == s.generation)
+				continue;
+			s.closed[node] = s.generation;
+			if (node == goal)
+				break;
+			int x = node % width, y = node / width;
+			int parent = s.parent[node];
+			directionsFrom(x, y, sign(x - parent % width), sign(y - parent / width), directions);
+			for (auto &d : directions) {
+				int next = jump(x + d.first, y + d.second, d.first, d.second, goalX, goalY);
+				if (next < 0 || s.closed[next] == s.generation)
+					continue;
+				int nextX = next % width, nextY = next / width;
+				int cost = s.cost[node] + octile(nextX - x, nextY - y);
+				if (s.seen[next] == s.generation && s.cost[next] <= cost)
+					continue;
+				s.seen[next] = s.generation;
+				s.cost[next] = cost;
+				s.parent[next] = node;
+				openList.push(std::make_pair(cost + octile(goalX - nextX, goalY - nextY), next));
+			}
+		}
+		if (s.closed[goal] != s.generation)
+			return path;
+
+		path.found = true;
+		for (int node = goal; node != start; node = s.parent[node])
+			path.waypoints.push_back(Position(node % width * 8 + 4, node / width * 8 + 4));
+		std::reverse(path.waypoints.begin(), path.waypoints.end());
+		if (path.waypoints.empty())
+			path.waypoints.push_back(to);
+		else
+			path.waypoints.back() = to;
+		Position last = from;
+		for (auto &p : path.waypoints) {
+			path.length += last.getApproxDistance(p);
+			last = p;
+		}
+		return path;
+	}
+
+	unsigned long long keyOf(Position from, Position to) {
+		unsigned long long start = (unsigned long long)(from.y / 8 * width + from.x / 8);
+		unsigned long long goal = (unsigned long long)(to.y / 8 * width + to.x / 8);
+		return start << 32 | goal;
+	}
+
+	bool fromCache(unsigned long long key, Path &path) {
+		auto it = cacheIndex.find(key);
+		if (it == cacheIndex.end())
+			return false;
+		cache.splice(cache.begin(), cache, it->second);
+		path = it->second->path;
+		return true;
+	}
+
+	void addToCache(unsigned long long key, Position from, const Path &path) {
+		if (cacheIndex.count(key))
+			return;
+		CacheEntry entry;
+		entry.key = key;
+		entry.path = path;
+		entry.left = entry.right = from.x / 8;
+		entry.top = entry.bottom = from.y / 8;
+		for (auto &p : path.waypoints) {
+			entry.left = std::min(entry.left, p.x / 8);
+			entry.right = std::max(entry.right, p.x / 8);
+			entry.top = std::min(entry.top, p.y / 8);
+			entry.bottom = std::max(entry.bottom, p.y / 8);
+		}
+		cache.push_front(entry);
+		cacheIndex[key] = cache.begin();
+		if (cache.size() > PATH_CACHE_SIZE) {
+			cacheIndex.erase(cache.back().key);
+			cache.pop_back();
+		}
+	}
+
+	bool isBusy() {
+		std::lock_guard<std::mutex> lock(runningMutex);
+		return running > 0;
+	}
+
+	///<summary>Delivers finished paths, updates the grid for buildings that have come and gone
+	///while nothing is searching, and starts the next batch of queued requests on the path
+	///search threads. Call every frame; callbacks run here, on the game thread.</summary>
+	void update() {
+		init();
+		std::vector<Request> finished;
+		finished.swap(ready);
+		if (!inFlight.empty() && !isBusy()) {
+			for (auto &r : inFlight) {
+				addToCache(keyOf(r.from, r.to), r.from, r.path);
+				finished.push_back(r);
+			}
+			inFlight.clear();
+		}
+		for (auto &r : finished)
+			r.callback(r.path);
+		if (!inFlight.empty())
+			return;
+
+		applyBuildingChanges();
+		size_t count = std::min(queued.size(), (size_t)PATH_BATCH_SIZE);
+		if (count == 0)
+			return;
+		inFlight.assign(queued.begin(), queued.begin() + count);
+		queued.erase(queued.begin(), queued.begin() + count);
+
+		if (!searchPool)
+			searchPool.reset(new ThreadPool(PATH_SEARCH_THREADS));
+		ThreadPool &pool = *searchPool;
+		int taskCount = std::min(pool.getThreadCount(), (int)inFlight.size());
+		{
+			std::lock_guard<std::mutex> lock(runningMutex);
+			running = taskCount;
+		}
+		//each task takes every taskCount'th request, so no two touch the same one
+		for (int t = 0; t < taskCount; t++) {
+			pool.enqueue([t, taskCount]() {
+				std::unique_ptr<SearchState> state = takeState();
+				for (size_t i = t; i < inFlight.size(); i += taskCount)
+					inFlight[i].path = TRACE_CALL("PathFinder::search", search(inFlight[i].from, inFlight[i].to, *state));
+				returnState(std::move(state));
+				std::lock_guard<std::mutex> lock(runningMutex);
+				running--;
+				allDone.notify_one();
+			});
+		}
+	}
+
+	///<summary>Waits for any searches still running, joins the search threads, then forgets the
+	///map. Call from onEnd.</summary>
+	void clear() {
+		{
+			std::unique_lock<std::mutex> lock(runningMutex);
+			allDone.wait(lock, []() { return running == 0; });
+		}
+		searchPool.reset();
+		walkable.clear();
+		open.clear();
+		cache.clear();
+		cacheIndex.clear();
+		newFootprints.clear();
+		buildingDestroyed = false;
+		queued.clear();
+		inFlight.clear();
+		ready.clear();
+		freeStates.clear();
+	}
+
+	void onUnitCreate(Unit unit) {
+		UnitType type = unit->getType();
+		if (!type.isBuilding() || walkable.empty())
+			return;
+		Footprint f;
+		f.left = (unit->getPosition().x - type.dimensionLeft()) / 8;
+		f.top = (unit->getPosition().y - type.dimensionUp()) / 8;
+		f.right = (unit->getPosition().x + type.dimensionRight()) / 8;
+		f.bottom = (unit->getPosition().y + type.dimensionDown()) / 8;
+		newFootprints.push_back(f);
+	}
+
+	void onUnitDestroy(Unit unit) {
+		if (unit->getType().isBuilding() || unit->getType().isMineralField())
+			buildingDestroyed = true;
+	}
+
+	///<summary>Returns the ground path between two positions, searching on the calling thread if
+	///it isn't cached. Call from the game thread.</summary>
+	Path findPath(Position from, Position to) {
+		Path path;
+		path.found = false;
+		path.length = 0;
+		init();
+		if (!from.isValid() || !to.isValid())
+			return path;
+		if (inFlight.empty())
+			applyBuildingChanges();
+		unsigned long long key = keyOf(from, to);
+		if (fromCache(key, path))
+			return path;
+		std::unique_ptr<SearchState> state = takeState();
+		path = TRACE_CALL("PathFinder::search", search(from, to, *state));
+		returnState(std::move(state));
+		addToCache(key, from, path);
+		return path;
+	}
+
+	///<summary>Asks for the ground path between two positions without waiting for it. The callback
+	///runs on the game thread during a later update, once the path is known; cached paths are
+	///delivered on the next one.</summary>
+	void requestPath(Position from, Position to, std::function<void(const Path&)> callback) {
+		Request r;
+		r.from = from;
+		r.to = to;
+		r.callback = callback;
+		r.path.found = false;
+		r.path.length = 0;
+		if (!from.isValid() || !to.isValid() || fromCache(keyOf(from, to), r.path)) {
+			ready.push_back(r);
+			return;
+		}
+		queued.push_back(r);
+	}
+
+	///<summary>Finds every walk tile a ground unit could get to from a point without leaving the
+	///square radius pixels around it. One flood answers any number of canReach questions, where
+	///a path search per question would explore the same ground over and over. Call from the
+	///game thread.</summary>
+	Reach floodFrom(Position from, int radius) {
+		Reach reach;
+		init();
+		if (inFlight.empty())
+			applyBuildingChanges();
+		int startX = from.x / 8, startY = from.y / 8;
+		reach.left = std::max(0, startX - radius / 8);
+		reach.top = std::max(0, startY - radius / 8);
+		reach.right = std::min(width - 1, startX + radius / 8);
+		reach.bottom = std::min(height - 1, startY + radius / 8);
+		int reachWidth = reach.right - reach.left + 1;
+		reach.reached.assign(reachWidth * (reach.bottom - reach.top + 1), false);
+		if (!from.isValid())
+			return reach;
+		//like search, the start may be under the unit's own building
+		std::vector<int> frontier;
+		frontier.push_back(startY * width + startX);
+		reach.reached[(startY - reach.top) * reachWidth + startX - reach.left] = true;
+		while (!frontier.empty()) {
+			int node = frontier.back();
+			frontier.pop_back();
+			int x = node % width, y = node / width;
+			for (int dy = -1; dy <= 1; dy++) {
+				for (int dx = -1; dx <= 1; dx++) {
+					int nextX = x + dx, nextY = y + dy;
+					if ((!dx && !dy) || nextX < reach.left || nextX > reach.right || nextY < reach.top || nextY > reach.bottom)
+						continue;
+					//no cutting corners, as in search
+					if (!isOpen(nextX, nextY) || (dx && dy && (!isOpen(x + dx, y) || !isOpen(x, y + dy))))
+						continue;
+					int index = (nextY - reach.top) * reachWidth + nextX - reach.left;
+					if (reach.reached[index])
+						continue;
+					reach.reached[index] = true;
+					frontier.push_back(nextY * width + nextX);
+				}
+			}
+		}
+		return reach;
+	}
+
+	///<summary>Returns true if a position is inside the square a flood explored, so canReach can
+	///answer for it.</summary>
+	bool covers(const Reach &reach, Position pos) {
+		int x = pos.x / 8, y = pos.y / 8;
+		return pos.isValid() && x >= reach.left && x <= reach.right && y >= reach.top && y <= reach.bottom;
+	}
+
+	///<summary>Returns true if the flood got to a position. Positions it doesn't cover are never
+	///reached.</summary>
+	bool canReach(const Reach &reach, Position pos) {
+		if (!covers(reach, pos))
+			return false;
+		int x = pos.x / 8, y = pos.y / 8;
+		return reach.reached[(y - reach.top) * (reach.right - reach.left + 1) + x - reach.left];
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <functional>
+
+#include "Shared.h"
+
+//paths kept in the cache; the least recently used are dropped first
+#define PATH_CACHE_SIZE 256
+//queued requests started together on the path search threads
+#define PATH_BATCH_SIZE 32
+//threads kept for path searches. They're apart from the shared pool, so queued searches never
+//hold up work the game thread waits on.
+#define PATH_SEARCH_THREADS 2
+//how far, in pixels, floodFrom explores by default
+#define PATH_FLOOD_RADIUS (32 * TILE_SIZE)
+
+namespace PathFinder {
+
+	typedef struct Path_t {
+		//whether there's a ground path at all; if not, the rest is empty
+		bool found;
+		//length of the path, in pixels
+		int length;
+		//where the path turns, in order, ending at the destination
+		std::vector<BWAPI::Position> waypoints;
+	} Path;
+
+	//the walk tiles a ground unit can get to from one point, within a square around it
+	typedef struct Reach_t {
+		//walk tile bounds of the square, inclusive
+		int left, top, right, bottom;
+		//whether each walk tile in the square can be reached, row-major within the square
+		std::vector<bool> reached;
+	} Reach;
+
+	void update();
+	void clear();
+	void onUnitCreate(BWAPI::Unit unit);
+	void onUnitDestroy(BWAPI::Unit unit);
+	Path findPath(BWAPI::Position from, BWAPI::Position to);
+	void requestPath(BWAPI::Position from, BWAPI::Position to, std::function<void(const Path&)> callback);
+	Reach floodFrom(BWAPI::Position from, int radius = PATH_FLOOD_RADIUS);
+	bool covers(const Reach &reach, BWAPI::Position pos);
+	bool canReach(const Reach &reach, BWAPI::Position pos);
+
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Prediction.h"
+
+using namespace BWAPI;
+
+namespace Prediction {
+
+	//the motion of each unit in a batch, gathered up front so the extrapolation is one flat loop
+	typedef struct Motion_t {
+		//whether we can see the unit at all; if not, the rest is unset
+		bool known;
+		double x;
+		double y;
+		//current velocity, in pixels per frame
+		double vx;
+		double vy;
+		//where the unit's order is taking it; only used if hasTarget
+		double targetX;
+		double targetY;
+		bool hasTarget;
+		//top speed after upgrades, in pixels per frame
+		double topSpeed;
+		//pixels per frame gained each frame, or 0 if the unit reaches top speed at once
+		double acceleration;
+	} Motion;
+
+	//reused between batches so predicting doesn't allocate every frame
+	static std::vector<Motion> motions;
+
+	///<summary>Returns how many frames pass between issuing a command and the unit acting
+	///on it. Commands should target where things will be by then.</summary>
+	int getCommandDelay() {
+		return Broodwar->getLatencyFrames();
+	}
+
+	void gather(Unit unit, Motion &m) {
+		m.known = unit->exists();
+		if (!m.known)
+			return;
+		Position pos = unit->getPosition();
+		m.x = pos.x;
+		m.y = pos.y;
+		m.vx = unit->getVelocityX();
+		m.vy = unit->getVelocityY();
+		UnitType type = unit->getType();
+		m.topSpeed = unit->getPlayer() ? unit->getPlayer()->topSpeed(type) : type.topSpeed();
+		m.acceleration = type.acceleration() <= PREDICTION_ANIMATED_ACCELERATION ? 0 : type.acceleration() / 256.0;
+		if ((type.isBuilding() && !unit->isFlying()) || unit->isSieged() || unit->isBurrowed() || unit->isLoaded())
+			m.topSpeed = 0;
+
+		//the unit it's chasing, if it can see it, is a better destination than where it was when the order was given
+		Unit orderTarget = unit->getOrderTarget();
+		Position target = orderTarget && orderTarget->isVisible() ? orderTarget->getPosition() : unit->getOrderTargetPosition();
+		m.hasTarget = target.isValid() && target != Positions::Origin && !unit->isHoldingPosition();
+		m.targetX = target.x;
+		m.targetY = target.y;
+	}
+
+	///<summary>Returns how far a unit moving at speed, accelerating toward topSpeed, travels
+	///in the specified number of frames.</summary>
+	double distanceAfter(double speed, double topSpeed, double acceleration, int frames) {
+		if (speed >= topSpeed)
+			return speed * frames;
+		if (acceleration <= 0)
+			return topSpeed * frames;
+		double framesToTopSpeed = (topSpeed - speed) / acceleration;
+		if (frames <= framesToTopSpeed)
+			return speed * frames + acceleration * frames * frames / 2;
+		return speed * framesToTopSpeed + acceleration * framesToTopSpeed * framesToTopSpeed / 2 + topSpeed * (frames - framesToTopSpeed);
+	}
+
+	///<summary>Extrapolates one unit. A unit with a destination heads straight for it,
+	///speeding up to its top speed and stopping when it arrives; one without keeps going the
+	///way it's already moving.</summary>
+	Position extrapolate(const Motion &m, int frames) {
+		if (!m.known)
+			return Positions::None;
+		double speed = std::sqrt(m.vx * m.vx + m.vy * m.vy);
+		double x = m.x;
+		double y = m.y;
+		if (m.topSpeed <= 0) {
+			//can't move; velocity is only left over from the transition
+		}
+		else if (m.hasTarget) {
+			double dx = m.targetX - m.x;
+			double dy = m.targetY - m.y;
+			double remaining = std::sqrt(dx * dx + dy * dy);
+			if (remaining > PREDICTION_ARRIVAL_DISTANCE) {
+				double travelled = std::min(remaining, distanceAfter(speed, m.topSpeed, m.acceleration, frames));
+				x += dx * travelled / remaining;
+				y += dy * travelled / remaining;
+			}
+		}
+		else if (speed > 0) {
+			double travelled = distanceAfter(speed, m.topSpeed, m.acceleration, frames);
+			x += m.vx * travelled / speed;
+			y += m.vy * travelled / speed;
+		}
+		Position predicted((int)(x + 0.5), (int)(y + 0.5));
+		return predicted.makeValid();
+	}
+
+	///<summary>Returns where a unit will be the specified number of frames from now, if it
+	///carries on with its current order.</summary>
+	Position predictPosition(Unit unit, int frames) {
+		if (!unit || !unit->exists())
+			return Positions::None;
+		if (frames <= 0)
+			return unit->getPosition();
+		Motion m;
+		gather(unit, m);
+		return extrapolate(m, frames);
+	}
+
+	///<summary>Predicts every unit in a set, in the set's iteration order, with Positions::None
+	///for units we can't see. Motions are all read from the game before any are extrapolated,
+	///keeping the arithmetic in one tight loop.</summary>
+	void predictPositions(const Unitset &units, int frames, std::vector<Position> &positions) {
+		motions.resize(units.size());
+		size_t count = 0;
+		for (auto &u : units)
+			gather(u, motions[count++]);
+		positions.resize(count);
+		for (size_t i = 0; i < count; i++)
+			positions[i] = extrapolate(motions[i], std::max(0, frames));
+	}
+
+	///<summary>Returns the average of the predicted positions of a set of units, or
+	///Positions::None for an empty set.</summary>
+	Position predictCenter(const Unitset &units, int frames) {
+		std::vector<Position> positions;
+		predictPositions(units, frames, positions);
+		int x = 0;
+		int y = 0;
+		int count = 0;
+		for (auto &p : positions) {
+			if (p == Positions::None)
+				continue;
+			x += p.x;
+			y += p.y;
+			count++;
+		}
+		if (count == 0)
+			return Positions::None;
+		return Position(x / count, y / count);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Shared.h"
+
+//acceleration reported by units that move by animation rather than by accelerating; they reach top speed at once
+#define PREDICTION_ANIMATED_ACCELERATION 1
+//order targets closer than this are treated as reached
+#define PREDICTION_ARRIVAL_DISTANCE 4
+
+namespace Prediction {
+
+	int getCommandDelay();
+	BWAPI::Position predictPosition(BWAPI::Unit unit, int frames);
+	void predictPositions(const BWAPI::Unitset &units, int frames, std::vector<BWAPI::Position> &positions);
+	BWAPI::Position predictCenter(const BWAPI::Unitset &units, int frames);
+
+}
\ No newline at end of file
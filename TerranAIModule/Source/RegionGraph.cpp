@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <atomic>
+#include <queue>
+
+#include "RegionGraph.h"
+#include "ThreadPool.h"
+#include "Trace.h"
+
+using namespace BWAPI;
+
+namespace RegionGraph {
+
+	//marks a missing next hop
+	static const unsigned short noHop = 0xFFFF;
+
+	//graph node of each region ID, or -1 for regions ground units can't use
+	static std::vector<int> nodeOf;
+	static std::vector<Region> nodes;
+	//edges of node i are edgeTargets[edgeStart[i]] to edgeTargets[edgeStart[i + 1] - 1]
+	static std::vector<int> edgeStart;
+	static std::vector<int> edgeTargets;
+	static std::vector<int> edgeWeights;
+	//shortest distance between every pair of nodes, row-major by source
+	static std::vector<int> distances;
+	//first node to visit on the shortest path between every pair of nodes, row-major by source
+	static std::vector<unsigned short> nextHops;
+
+	///<summary>Fills in one source's rows of the distance and next hop tables. Rows are only ever
+	///written by the one task that owns their source, so sources can run in parallel.</summary>
+	void dijkstra(int source) {
+		int n = (int)nodes.size();
+		int *dist = &distances[source * n];
+		unsigned short *hop = &nextHops[source * n];
+		std::vector<bool> done(n, false);
+		std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> open;
+		dist[source] = 0;
+		hop[source] = (unsigned short)source;
+		open.push(std::make_pair(0, source));
+		while (!open.empty()) {
+			int u = open.top().second;
+			open.pop();
+			if (done[u])
+				continue;
+			done[u] = true;
+			for (int e = edgeStart[u]; e < edgeStart[u + 1]; e++) {
+				int v = edgeTargets[e];
+				int d = dist[u] + edgeWeights[e];
+				if (dist[v] != REGION_GRAPH_UNREACHABLE && dist[v] <= d)
+					continue;
+				dist[v] = d;
+				hop[v] = u == source ? (unsigned short)v : hop[u];
+				open.push(std::make_pair(d, v));
+			}
+		}
+	}
+
+	///<summary>Builds the graph of accessible regions, weighted by the distance between their
+	///centres, and runs Dijkstra from every region on the shared thread pool. Call at the start
+	///of the game; returns once every path is known.</summary>
+	void init() {
+		if (!nodes.empty())
+			return;
+		TRACE_SCOPE("RegionGraph::init");
+		for (auto &r : Broodwar->getAllRegions()) {
+			if (!r->isAccessible())
+				continue;
+			if (r->getID() >= (int)nodeOf.size())
+				nodeOf.resize(r->getID() + 1, -1);
+			nodeOf[r->getID()] = (int)nodes.size();
+			nodes.push_back(r);
+		}
+		int n = (int)nodes.size();
+		if (n == 0 || n > REGION_GRAPH_MAX_NODES) {
+			clear();
+			return;
+		}
+
+		for (int i = 0; i < n; i++) {
+			edgeStart.push_back((int)edgeTargets.size());
+			for (auto &neighbor : nodes[i]->getNeighbors()) {
+				if (neighbor->getID() >= (int)nodeOf.size() || nodeOf[neighbor->getID()] < 0)
+					continue;
+				edgeTargets.push_back(nodeOf[neighbor->getID()]);
+				edgeWeights.push_back(std::max(1, (int)nodes[i]->getCenter().getDistance(neighbor->getCenter())));
+			}
+		}
+		edgeStart.push_back((int)edgeTargets.size());
+		distances.assign(n * n, REGION_GRAPH_UNREACHABLE);
+		nextHops.assign(n * n, noHop);
+
+		ThreadPool &pool = ThreadPool::getShared();
+		int taskCount = pool.getThreadCount();
+		std::atomic<int> nextSource(0);
+		std::mutex doneMutex;
+		std::condition_variable allDone;
+		int running = taskCount;
+		for (int t = 0; t < taskCount; t++) {
+			pool.enqueue([&]() {
+				for (int source = nextSource++; source < n; source = nextSource++)
+					dijkstra(source);
+				std::lock_guard<std::mutex> lock(doneMutex);
+				running--;
+				allDone.notify_one();
+			});
+		}
+		std::unique_lock<std::mutex> lock(doneMutex);
+		allDone.wait(lock, [&running]() { return running == 0; });
+	}
+
+	void clear() {
+		nodeOf.clear();
+		nodes.clear();
+		edgeStart.clear();
+		edgeTargets.clear();
+		edgeWeights.clear();
+		distances.clear();
+		nextHops.clear();
+	}
+
+	bool isReady() {
+		return !distances.empty();
+	}
+
+	///<summary>Returns the graph node of a region, standing in the closest accessible region for
+	///one ground units can't use, or -1.</summary>
+	int nodeFor(Region r) {
+		if (!r)
+			return -1;
+		if (!r->isAccessible())
+			r = r->getClosestAccessibleRegion();
+		if (!r || r->getID() >= (int)nodeOf.size())
+			return -1;
+		return nodeOf[r->getID()];
+	}
+
+	int nodeAt(Position pos) {
+		if (!pos.isValid())
+			return -1;
+		return nodeFor(Broodwar->getRegionAt(pos));
+	}
+
+	///<summary>Returns the ground distance between the centres of two regions, or
+	///REGION_GRAPH_UNREACHABLE.</summary>
+	int getRegionDistance(Region from, Region to) {
+		if (!isReady())
+			return REGION_GRAPH_UNREACHABLE;
+		int a = nodeFor(from);
+		int b = nodeFor(to);
+		if (a < 0 || b < 0)
+			return REGION_GRAPH_UNREACHABLE;
+		return distances[a * nodes.size() + b];
+	}
+
+	///<summary>Estimates how far a ground unit would travel between two positions: to the centre
+	///of its region, along the region graph, then on to the destination. Positions in the same
+	///region are measured directly. Returns REGION_GRAPH_UNREACHABLE if there's no ground path
+	///or the graph isn't built.</summary>
+	int getGroundDistance(Position from, Position to) {
+		if (!isReady())
+			return REGION_GRAPH_UNREACHABLE;
+		int a = nodeAt(from);
+		int b = nodeAt(to);
+		if (a < 0 || b < 0)
+			return REGION_GRAPH_UNREACHABLE;
+		if (a == b)
+			return from.getApproxDistance(to);
+		int between = distances[a * nodes.size() + b];
+		if (between == REGION_GRAPH_UNREACHABLE)
+			return REGION_GRAPH_UNREACHABLE;
+		return from.getApproxDistance(nodes[a]->getCenter()) + between + nodes[b]->getCenter().getApproxDistance(to);
+	}
+
+	///<summary>Returns the waypoints a ground unit would follow: the centre of each region after
+	///the first, then the destination itself. Empty if there's no ground path.</summary>
+	std::vector<Position> getPath(Position from, Position to) {
+		std::vector<Position> path;
+		if (!isReady())
+			return path;
+		int a = nodeAt(from);
+		int b = nodeAt(to);
+		if (a < 0 || b < 0 || nextHops[a * nodes.size() + b] == noHop)
+			return path;
+		while (a != b) {
+			a = nextHops[a * nodes.size() + b];
+			if (a != b)
+				path.push_back(nodes[a]->getCenter());
+		}
+		path.push_back(to);
+		return path;
+	}
+
+	///<summary>Returns the point the specified ground distance along the path between two
+	///positions, or the destination if the path is shorter. Returns Positions::None if there's
+	///no ground path.</summary>
+	Position getPointAlongPath(Position from, Position to, int distance) {
+		std::vector<Position> path = getPath(from, to);
+		if (path.empty())
+			return Positions::None;
+		Position last = from;
+		for (auto &p : path) {
+			int length = last.getApproxDistance(p);
+			if (length >= distance) {
+				if (length == 0)
+					return p;
+				return last + (p - last) * distance / length;
+			}
+			distance -= length;
+			last = p;
+		}
+		return to;
+	}
+
+}
\ No newline at end of file
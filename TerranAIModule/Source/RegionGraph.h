@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Shared.h"
+
+//most accessible regions we'll precompute paths between; the tables grow with the square of this
+#define REGION_GRAPH_MAX_NODES 2048
+//returned by the distance queries when there's no ground path, or no graph
+#define REGION_GRAPH_UNREACHABLE -1
+
+namespace RegionGraph {
+
+	void init();
+	void clear();
+	bool isReady();
+	int getRegionDistance(BWAPI::Region from, BWAPI::Region to);
+	int getGroundDistance(BWAPI::Position from, BWAPI::Position to);
+	std::vector<BWAPI::Position> getPath(BWAPI::Position from, BWAPI::Position to);
+	BWAPI::Position getPointAlongPath(BWAPI::Position from, BWAPI::Position to, int distance);
+
+}
\ No newline at end of file
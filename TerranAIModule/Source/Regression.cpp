@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "Regression.h"
+#include "EnemyMemory.h"
+#include "ThreadPool.h"
+
+using namespace BWAPI;
+
+namespace Regression {
+
+	//one stretch of the game that is measured and checked as a scenario of its own
+	typedef struct Phase_t {
+		//appended to the map name to name the scenario
+		const char *name;
+		//frame the phase was reached on, or -1 if it hasn't been
+		int startFrame;
+		//frames measured once the phase is reached
+		int length;
+		//how long each of the bot's frames in the phase took, in milliseconds
+		std::vector<double> frameTimes;
+		//actions sent to the game during the phase
+		int commands;
+	} Phase;
+
+	enum { EARLY, MID, LATE, PHASE_COUNT };
+
+	//the map being played, named after its file
+	static std::string mapName;
+	static Phase phases[PHASE_COUNT];
+	static bool recording = false;
+	static bool leaving = false;
+
+	bool isEnabled() {
+		return REGRESSION_HARNESS != 0;
+	}
+
+	void resetPhase(Phase &phase, const char *name, int startFrame, int length) {
+		phase.name = name;
+		phase.startFrame = startFrame;
+		phase.length = length;
+		phase.frameTimes.clear();
+		phase.frameTimes.reserve(length);
+		phase.commands = 0;
+	}
+
+	bool isMeasuring(const Phase &phase, int frame) {
+		return phase.startFrame >= 0 && frame >= phase.startFrame && frame < phase.startFrame + phase.length;
+	}
+
+	bool isDone(const Phase &phase, int frame) {
+		return phase.startFrame >= 0 && frame >= phase.startFrame + phase.length;
+	}
+
+	///<summary>Makes the game repeatable: seeds the bot's random numbers and fixes the size of the
+	///shared thread pool. Call from onStart, before anything uses either.</summary>
+	void start() {
+		if (!isEnabled())
+			return;
+		Helpers::seedRandom(REGRESSION_SEED);
+		ThreadPool::setSharedThreadCount(REGRESSION_THREADS);
+
+		mapName = Broodwar->mapFileName();
+		size_t extension = mapName.find_last_of('.');
+		if (extension != std::string::npos)
+			mapName.erase(extension);
+		resetPhase(phases[EARLY], "early", 0, REGRESSION_EARLY_FRAMES);
+		resetPhase(phases[MID], "mid", -1, REGRESSION_PHASE_FRAMES);
+		resetPhase(phases[LATE], "late", -1, REGRESSION_PHASE_FRAMES);
+		FILE *flag = fopen(REGRESSION_RECORD_FILE, "rt");
+		recording = flag != nullptr;
+		if (flag)
+			fclose(flag);
+		leaving = false;
+	}
+
+	///<summary>Records how long one of the bot's frames took, in every phase being measured.
+	///Negative times, from before the first frame has ended, are ignored.</summary>
+	void recordFrame(double milliseconds) {
+		if (!isEnabled() || milliseconds < 0)
+			return;
+		int frame = Broodwar->getFrameCount();
+		for (auto &phase : phases) {
+			if (isMeasuring(phase, frame))
+				phase.frameTimes.push_back(milliseconds);
+		}
+	}
+
+	///<summary>Adds a flushed frame's commands to every phase being measured.</summary>
+	void recordCommands(const CommandDispatcher::CommandCounts &counts) {
+		if (!isEnabled())
+			return;
+		int frame = Broodwar->getFrameCount();
+		for (auto &phase : phases) {
+			if (isMeasuring(phase, frame))
+				phase.commands += counts.issued;
+		}
+	}
+
+	///<summary>Starts the mid and late phases once the game reaches them, and leaves once every
+	///phase has been measured or the game has run for REGRESSION_MAX_FRAMES.</summary>
+	void update() {
+		if (!isEnabled() || leaving)
+			return;
+		int frame = Broodwar->getFrameCount();
+		if (phases[MID].startFrame < 0 &&
+			(int)(Broodwar->self()->getUnits().size() + EnemyMemory::getRecords().size()) >= REGRESSION_MID_UNITS)
+			phases[MID].startFrame = frame;
+		if (phases[LATE].startFrame < 0 && Broodwar->self()->supplyUsed() >= REGRESSION_LATE_SUPPLY)
+			phases[LATE].startFrame = frame;
+
+		bool allDone = true;
+		for (auto &phase : phases)
+			allDone &= isDone(phase, frame);
+		if (allDone || frame >= REGRESSION_MAX_FRAMES) {
+			leaving = true;
+			Broodwar->leaveGame();
+		}
+	}
+
+	///<summary>Returns the nearest-rank percentile of the sorted times.</summary>
+	double percentile(const std::vector<double> &sorted, double fraction) {
+		if (sorted.empty())
+			return 0.0;
+		int rank = (int)std::ceil(fraction * sorted.size());
+		return sorted[std::max(rank, 1) - 1];
+	}
+
+	///<summary>Looks the scenario up in the baseline file. Lines starting with # are comments.
+	///Names can contain spaces, so the three numbers are read from the end of the line. If the
+	///scenario was recorded more than once, the last line wins.</summary>
+	bool loadBaseline(const std::string &name, ScenarioResult &baseline) {
+		FILE *f = fopen(REGRESSION_BASELINE_FILE, "rt");
+		if (!f)
+			return false;
+		bool found = false;
+		char line[512];
+		while (fgets(line, sizeof(line), f)) {
+			if (line[0] == '#')
+				continue;
+			std::string text(line);
+			//the name, then three space separated numbers
+			size_t end = text.find_last_not_of(" \t\r\n");
+			size_t split = end;
+			for (int field = 0; field < 3 && split != std::string::npos; field++) {
+				split = text.find_last_of(" \t", split);
+				if (split != std::string::npos)
+					split = text.find_last_not_of(" \t", split);
+			}
+			if (end == std::string::npos || split == std::string::npos)
+				continue;
+			ScenarioResult r;
+			if (sscanf(text.c_str() + split + 1, "%lf %lf %d", &r.p50, &r.p99, &r.commands) != 3)
+				continue;
+			if (name == text.substr(0, split + 1)) {
+				baseline = r;
+				found = true;
+			}
+		}
+		fclose(f);
+		return found;
+	}
+
+	bool timeRegressed(double measured, double baseline) {
+		return measured > baseline * (100 + REGRESSION_TIME_TOLERANCE_PERCENT) / 100.0
+			&& measured - baseline > REGRESSION_TIME_SLACK_MS;
+	}
+
+	///<summary>Adds the scenario to REGRESSION_FAILED_FILE, which a CI script checks for once
+	///the corpus has been played.</summary>
+	void markFailed(const std::string &scenario, const char *reason) {
+		FILE *f = fopen(REGRESSION_FAILED_FILE, "at");
+		if (!f)
+			return;
+		fprintf(f, "%s: %s\n", scenario.c_str(), reason);
+		fclose(f);
+	}
+
+	///<summary>Compares one phase against its baseline line and appends the verdict to the
+	///results, or while recording, appends the phase to the baseline instead.</summary>
+	void finishPhase(Phase &phase, FILE *results) {
+		std::string scenario = mapName + " " + phase.name;
+		ScenarioResult baseline;
+		bool hasBaseline = !recording && loadBaseline(scenario, baseline);
+		if (phase.frameTimes.empty()) {
+			//a phase the game used to reach and no longer does has lost its coverage
+			if (hasBaseline) {
+				if (results)
+					fprintf(results, "FAIL %s: not reached in %d frames\n", scenario.c_str(), Broodwar->getFrameCount());
+				markFailed(scenario, "not reached");
+			}
+			else if (results)
+				fprintf(results, "SKIP %s: not reached in %d frames\n", scenario.c_str(), Broodwar->getFrameCount());
+			return;
+		}
+
+		std::sort(phase.frameTimes.begin(), phase.frameTimes.end());
+		ScenarioResult measured;
+		measured.p50 = percentile(phase.frameTimes, 0.50);
+		measured.p99 = percentile(phase.frameTimes, 0.99);
+		measured.commands = phase.commands;
+
+		if (recording) {
+			FILE *record = fopen(REGRESSION_BASELINE_FILE, "at");
+			if (record) {
+				fprintf(record, "%s %.3f %.3f %d\n", scenario.c_str(), measured.p50, measured.p99, measured.commands);
+				fclose(record);
+			}
+			if (results)
+				fprintf(results, "RECORDED %s %.3f %.3f %d, %d frames\n", scenario.c_str(),
+					measured.p50, measured.p99, measured.commands, (int)phase.frameTimes.size());
+			return;
+		}
+
+		if (!hasBaseline) {
+			if (results)
+				fprintf(results, "MISSING %s: no baseline; measured \"%s %.3f %.3f %d\"\n", scenario.c_str(),
+					scenario.c_str(), measured.p50, measured.p99, measured.commands);
+			markFailed(scenario, "no baseline");
+			return;
+		}
+		bool failed = timeRegressed(measured.p50, baseline.p50)
+			|| timeRegressed(measured.p99, baseline.p99)
+			|| measured.commands > baseline.commands * (100 + REGRESSION_COMMAND_TOLERANCE_PERCENT) / 100.0;
+		if (results)
+			fprintf(results, "%s %s: p50 %.3f ms (baseline %.3f), p99 %.3f ms (baseline %.3f), %d commands (baseline %d), %d frames\n",
+				failed ? "FAIL" : "PASS", scenario.c_str(), measured.p50, baseline.p50, measured.p99, baseline.p99,
+				measured.commands, baseline.commands, (int)phase.frameTimes.size());
+		if (failed)
+			markFailed(scenario, "slower or chattier than its baseline");
+	}
+
+	///<summary>Checks or records every phase of the game. Call from onEnd.</summary>
+	void finish() {
+		if (!isEnabled() || mapName.empty())
+			return;
+		FILE *results = fopen(REGRESSION_RESULTS_FILE, "at");
+		for (auto &phase : phases) {
+			finishPhase(phase, results);
+			phase.frameTimes.clear();
+		}
+		if (results)
+			fclose(results);
+		mapName.clear();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Shared.h"
+#include "CommandDispatcher.h"
+
+//Frame-time regression harness. With REGRESSION_HARNESS set to 1, the bot plays each game
+//in a fixed, repeatable way and measures how long its frames took and how many commands it
+//sent in three scenarios per game, each compared against its own baseline line:
+//  "<map> early"  the first REGRESSION_EARLY_FRAMES frames, where rushes land
+//  "<map> mid"    REGRESSION_PHASE_FRAMES frames from when REGRESSION_MID_UNITS units are in
+//                 play, ours plus the enemy units we know of
+//  "<map> late"   REGRESSION_PHASE_FRAMES frames from when our supply is maxed
+//The bot leaves once the late scenario has been measured, or at REGRESSION_MAX_FRAMES.
+//
+//The corpus is the SSCAIT map pack (sscaitournament.com), the maps bots are usually measured
+//on, copied into maps/regression/. <map> is the map's file name, so maps/regression/(4)Fighting
+//Spirit.scx gives "(4)Fighting Spirit early" and so on. The bot plays each map from the start
+//against the built-in AI, and a fixed seed makes every run of a map the same game.
+//To play the whole corpus unattended, set these in bwapi.ini:
+//  [auto_menu]  auto_menu = SINGLE_PLAYER, map = maps/regression/*.sc?, mapiteration = SEQUENCE,
+//               race = Terran, enemy_race = Random, game_type = MELEE, auto_restart = ON
+//  [starcraft]  seed_override = <any fixed number>, speed_override = 0
+//Each scenario appends a PASS, FAIL, MISSING or SKIP line to REGRESSION_RESULTS_FILE. A scenario
+//that fails, has no baseline, or has a baseline but was not reached this time also appends
+//its name to REGRESSION_FAILED_FILE, so a run has regressed if that file exists afterwards.
+//A scenario the game never reached and that has no baseline is only reported as SKIP.
+//
+//Frame times depend on the machine, so the baseline has to be recorded on the one the
+//harness runs on. bwapi-data/regression_check.bat drives both steps:
+//  regression_check record   then play the corpus, then regression_check: records the
+//                            baseline; commit the lines added to REGRESSION_BASELINE_FILE
+//  regression_check clean    then play the corpus, then regression_check: checks the run
+//While REGRESSION_RECORD_FILE exists the bot records instead of checking. Recording again
+//supersedes earlier lines.
+
+//set to 1 to run the regression harness instead of playing normally
+#define REGRESSION_HARNESS 0
+//frames measured for the early scenario, from the start of the game
+#define REGRESSION_EARLY_FRAMES (24 * 60 * 5)
+//frames measured for the mid and late scenarios, from when each is reached
+#define REGRESSION_PHASE_FRAMES (24 * 60 * 2)
+//units in play, ours plus the enemy units we know of, that start the mid scenario
+#define REGRESSION_MID_UNITS 100
+//supply used that starts the late scenario; BWAPI counts supply in halves, so this is 190
+#define REGRESSION_LATE_SUPPLY (190 * 2)
+//frames after which the bot leaves even if a scenario was never reached
+#define REGRESSION_MAX_FRAMES (24 * 60 * 40)
+//seed for the bot's own random numbers
+#define REGRESSION_SEED 1
+//worker threads in the shared thread pool, whatever the machine has; path searches have their
+//own pool, already fixed at PATH_SEARCH_THREADS
+#define REGRESSION_THREADS 3
+//a frame time this many percent above the baseline fails the scenario
+#define REGRESSION_TIME_TOLERANCE_PERCENT 15
+//frame time differences this small, in milliseconds, never fail a scenario; timer noise alone
+//can exceed the tolerance on very short frames
+#define REGRESSION_TIME_SLACK_MS 0.05
+//a command count this many percent above the baseline fails the scenario
+#define REGRESSION_COMMAND_TOLERANCE_PERCENT 5
+//one line per scenario: name, p50 frame time (ms), p99 frame time (ms), commands sent
+#define REGRESSION_BASELINE_FILE "bwapi-data/read/regression_baseline.txt"
+#define REGRESSION_RESULTS_FILE "bwapi-data/write/regression_results.txt"
+//created when a scenario fails, has no baseline or was not reached, with one line per such scenario
+#define REGRESSION_FAILED_FILE "bwapi-data/write/regression_failed.txt"
+//while this file exists, each scenario is appended to the baseline instead of being checked
+#define REGRESSION_RECORD_FILE "bwapi-data/write/regression_record.txt"
+
+namespace Regression {
+
+	typedef struct ScenarioResult_t {
+		//median frame time, in milliseconds
+		double p50;
+		//99th percentile frame time, in milliseconds
+		double p99;
+		//actions sent to the game over the whole scenario
+		int commands;
+	} ScenarioResult;
+
+	bool isEnabled();
+	void start();
+	void recordFrame(double milliseconds);
+	void recordCommands(const CommandDispatcher::CommandCounts &counts);
+	void update();
+	void finish();
+
+}
\ No newline at end of file
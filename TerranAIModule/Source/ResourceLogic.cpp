@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ResourceLogic.h"
+#include "EventScheduler.h"
 
 using namespace BWAPI;
 
@@ -37,10 +38,9 @@ namespace ResourceLogic {
 			}
 		}
 
-		Broodwar->registerEvent([projectedSupplyUsage](Game*){
+		EventScheduler::schedule([projectedSupplyUsage](){
 			Broodwar->drawTextScreen(450, 20, "Proj. Supply Usage: %d", projectedSupplyUsage / 2);
 		},
-			nullptr,						//condition
 			Broodwar->getLatencyFrames());	//duration in frames
 
 		int requiredSupply = projectedSupplyUsage - Broodwar->self()->supplyTotal();
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <queue>
+
+#include "ScanPlanner.h"
+#include "EnemyMemory.h"
+#include "CommandDispatcher.h"
+
+using namespace BWAPI;
+
+namespace ScanPlanner {
+
+	//a sweep we've ordered that is still, or will soon be, revealing its area
+	typedef struct ActiveScan_t {
+		BWAPI::Unit comsat;
+		BWAPI::Position position;
+		int expires;
+	} ActiveScan;
+
+	static std::vector<ActiveScan> activeScans;
+
+	int valueOf(UnitType type) {
+		int value = type.mineralPrice() + type.gasPrice();
+		//zerglings and scourge are priced per pair
+		if (type.isTwoUnitsInOneEgg())
+			value /= 2;
+		return value;
+	}
+
+	//targets are bucketed into cells SCAN_COVER_RADIUS wide, so a scan centred on a target only
+	//covers targets in that target's cell and the eight around it
+	int cellKey(Position pos) {
+		return (pos.y / SCAN_COVER_RADIUS) * 1024 + pos.x / SCAN_COVER_RADIUS;
+	}
+
+	bool isUnderActiveScan(Position pos) {
+		for (auto &s : activeScans) {
+			if (s.position.getApproxDistance(pos) <= SCAN_COVER_RADIUS)
+				return true;
+		}
+		return false;
+	}
+
+	///<summary>Collects the enemies a scan would reveal: cloaked or burrowed units we can't
+	///currently detect, and ones we lost sight of recently. Targets under a sweep we've already
+	///ordered are left out.</summary>
+	void gatherTargets(std::vector<ScanTarget> &targets) {
+		int frame = Broodwar->getFrameCount();
+		for (auto &player : Broodwar->enemies()) {
+			for (auto &u : player->getUnits()) {
+				if (!(u->isCloaked() || u->isBurrowed()) || u->isDetected())
+					continue;
+				ScanTarget t = { u->getPosition(), valueOf(u->getType()), false };
+				targets.push_back(t);
+			}
+		}
+		for (auto &entry : EnemyMemory::getRecords()) {
+			const EnemyMemory::EnemyRecord &r = entry.second;
+			if (r.visible || !r.isCloaked || !r.positionKnown || frame - r.lastSeenFrame > SCAN_MEMORY_FRAMES)
+				continue;
+			ScanTarget t = { r.lastPosition, valueOf(r.type), false };
+			targets.push_back(t);
+		}
+		targets.erase(std::remove_if(targets.begin(), targets.end(), [](const ScanTarget &t) {
+			return !t.position.isValid() || isUnderActiveScan(t.position);
+		}), targets.end());
+	}
+
+	///<summary>Calls visit on every uncovered target within SCAN_COVER_RADIUS of pos. Targets
+	///must be sorted by cellKey.</summary>
+	template <class Visit>
+	void forEachNear(std::vector<ScanTarget> &targets, Position pos, Visit visit) {
+		int cx = pos.x / SCAN_COVER_RADIUS;
+		int cy = pos.y / SCAN_COVER_RADIUS;
+		for (int dy = -1; dy <= 1; dy++) {
+			for (int dx = -1; dx <= 1; dx++) {
+				if (cx + dx < 0 || cy + dy < 0)
+					continue;
+				int key = (cy + dy) * 1024 + cx + dx;
+				auto first = std::lower_bound(targets.begin(), targets.end(), key, [](const ScanTarget &t, int k) { return cellKey(t.position) < k; });
+				for (auto it = first; it != targets.end() && cellKey(it->position) == key; it++) {
+					if (!it->covered && it->position.getApproxDistance(pos) <= SCAN_COVER_RADIUS)
+						visit(*it);
+				}
+			}
+		}
+	}
+
+	int uncoveredValueNear(std::vector<ScanTarget> &targets, Position pos) {
+		int value = 0;
+		forEachNear(targets, pos, [&value](ScanTarget &t) { value += t.value; });
+		return value;
+	}
+
+	///<summary>Plans this evaluation's scans across every comsat at once. Each target is a
+	///candidate scan centre, valued by the targets it would reveal. The best candidate goes to
+	///the comsat with the most energy, its targets are marked covered, and the rest are
+	///re-valued lazily: a candidate is only recounted when it reaches the top of the queue, so
+	///the whole plan is one sort's worth of work. Every sweep costs the same energy, so the most
+	///value per scan is also the most per energy.</summary>
+	void update() {
+		int frame = Broodwar->getFrameCount();
+		//the dispatcher only accepts a sweep when it's planned; one the game refused at the flush
+		//never happened, so its area is open to be scanned again
+		activeScans.erase(std::remove_if(activeScans.begin(), activeScans.end(), [frame](const ActiveScan &s) {
+			return s.expires <= frame ||
+				CommandDispatcher::wasDropped(s.comsat, UnitCommand::useTech(s.comsat, TechTypes::Scanner_Sweep, s.position));
+		}), activeScans.end());
+
+		std::vector<Unit> comsats;
+		for (auto &u : Broodwar->self()->getUnits()) {
+			if (u->getType() == UnitTypes::Terran_Comsat_Station && u->isCompleted()
+				&& u->getEnergy() >= TechTypes::Scanner_Sweep.energyCost())
+				comsats.push_back(u);
+		}
+		if (comsats.empty())
+			return;
+
+		std::vector<ScanTarget> targets;
+		gatherTargets(targets);
+		if (targets.empty())
+			return;
+		std::sort(targets.begin(), targets.end(), [](const ScanTarget &a, const ScanTarget &b) {
+			return cellKey(a.position) < cellKey(b.position);
+		});
+		std::sort(comsats.begin(), comsats.end(), [](Unit a, Unit b) { return a->getEnergy() > b->getEnergy(); });
+
+		//candidates as (value when last counted, target index)
+		std::priority_queue<std::pair<int, int>> candidates;
+		for (int i = 0; i < (int)targets.size(); i++)
+			candidates.push(std::make_pair(uncoveredValueNear(targets, targets[i].position), i));
+
+		size_t nextComsat = 0;
+		while (!candidates.empty() && nextComsat < comsats.size()) {
+			std::pair<int, int> top = candidates.top();
+			candidates.pop();
+			Position center = targets[top.second].position;
+			int value = uncoveredValueNear(targets, center);
+			if (value < SCAN_MIN_VALUE)
+				continue;
+			//something else covered part of it since it was counted; requeue unless it's still the best
+			if (value < top.first && !candidates.empty() && value < candidates.top().first) {
+				candidates.push(std::make_pair(value, top.second));
+				continue;
+			}
+
+			//centre the sweep on the group if that still reveals all of it
+			Position sum(0, 0);
+			int count = 0;
+			forEachNear(targets, center, [&sum, &count](ScanTarget &t) { sum += t.position; count++; });
+			Position mean = sum / count;
+			bool meanCovers = true;
+			forEachNear(targets, center, [&mean, &meanCovers](ScanTarget &t) {
+				meanCovers &= t.position.getApproxDistance(mean) <= SCAN_COVER_RADIUS;
+			});
+			if (meanCovers)
+				center = mean;
+
+			Unit comsat = comsats[nextComsat++];
+			if (!CommandDispatcher::issue(comsat, UnitCommand::useTech(comsat, TechTypes::Scanner_Sweep, center)))
+				continue;
+			forEachNear(targets, center, [](ScanTarget &t) { t.covered = true; });
+			ActiveScan scan = { comsat, center, frame + Broodwar->getLatencyFrames() + SCAN_DURATION_FRAMES };
+			activeScans.push_back(scan);
+		}
+	}
+
+	void clear() {
+		activeScans.clear();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Shared.h"
+
+//targets this close to a scan's centre count as covered by it; a little under the sweep's
+//sight range, since remembered positions drift
+#define SCAN_COVER_RADIUS (8 * TILE_SIZE)
+//frames a sweep keeps an area revealed
+#define SCAN_DURATION_FRAMES 262
+//least resource value of the targets under a scan for it to be worth the energy
+#define SCAN_MIN_VALUE 100
+//frames after losing sight of a cloaked or burrowed unit that we'll still scan where it was
+#define SCAN_MEMORY_FRAMES (24 * 10)
+
+namespace ScanPlanner {
+
+	//an undetected enemy we'd like to reveal
+	typedef struct ScanTarget_t {
+		BWAPI::Position position;
+		//resource value of the unit
+		int value;
+		//whether a scan planned this evaluation already reveals it
+		bool covered;
+	} ScanTarget;
+
+	void update();
+	void clear();
+
+}
\ No newline at end of file
@@ -1,7 +1,12 @@
+#include <random>
+
 #include "Shared.h"
 
 using namespace BWAPI;
 
+//only the bot draws from this, so seeding it makes getRandomPosition repeatable
+static std::minstd_rand randomEngine;
+
 bool Helpers::unitIsDisabled(BWAPI::Unit unit) {
 
 	if (!unit->exists() ||
@@ -34,12 +39,16 @@ Position Helpers::getRandomPosition() {
 	int maxY = Broodwar->mapHeight() * TILE_SIZE;
 
 	Position p;
-	p.x = rand() % maxX;
-	p.y = rand() % maxY;
+	p.x = (int)(randomEngine() % maxX);
+	p.y = (int)(randomEngine() % maxY);
 
 	return p;
 }
 
+void Helpers::seedRandom(unsigned int seed) {
+	randomEngine.seed(seed);
+}
+
 bool Helpers::requirementsMet(UnitType type) {
 	bool techAvailable = true;
 	for (auto &m : type.requiredUnits()) {
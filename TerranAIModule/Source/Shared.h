@@ -16,5 +16,6 @@ namespace Helpers {
 	extern bool unitIsDisabled(BWAPI::Unit unit);
 	extern int getOwnedUnitCountOfType(BWAPI::UnitType type);
 	extern BWAPI::Position getRandomPosition();
+	extern void seedRandom(unsigned int seed);
 	extern bool requirementsMet(BWAPI::UnitType type);
 }
\ No newline at end of file
@@ -0,0 +1,243 @@
+#include <map>
+
+#include "Squads.h"
+
+using namespace BWAPI;
+
+namespace Squads {
+
+	//where an army unit sits in the clustering grid
+	typedef struct Member_t {
+		int cell;
+		//index into squads of the squad this unit belongs to
+		int squadIndex;
+		//id of the squad this unit belonged to after the last clustering, or -1
+		int squadId;
+		//update on which the unit was last present in the army
+		int lastUpdate;
+	} Member;
+
+	static std::unordered_map<Unit, Member> members;
+	static std::vector<Squad> squads;
+	//number of army units in each cell
+	static std::vector<int> cellCounts;
+	//cluster label of each cell; only meaningful where cellStamps matches the current clustering pass
+	static std::vector<int> cellLabels;
+	static std::vector<int> cellStamps;
+	static int gridWidth = 0;
+	static int gridHeight = 0;
+	static int updateCount = 0;
+	static int clusteringPass = 0;
+	static int nextSquadId = 0;
+
+	void initGrid() {
+		if (!cellCounts.empty())
+			return;
+		gridWidth = (Broodwar->mapWidth() + SQUAD_CELL_TILES - 1) / SQUAD_CELL_TILES;
+		gridHeight = (Broodwar->mapHeight() + SQUAD_CELL_TILES - 1) / SQUAD_CELL_TILES;
+		cellCounts.assign(gridWidth * gridHeight, 0);
+		cellLabels.assign(gridWidth * gridHeight, -1);
+		cellStamps.assign(gridWidth * gridHeight, 0);
+	}
+
+	int cellOf(Position pos) {
+		int x = std::max(0, std::min(pos.x / (SQUAD_CELL_TILES * TILE_SIZE), gridWidth - 1));
+		int y = std::max(0, std::min(pos.y / (SQUAD_CELL_TILES * TILE_SIZE), gridHeight - 1));
+		return y * gridWidth + x;
+	}
+
+	///<summary>Returns the number of army units in a cell and the eight cells around it.</summary>
+	int neighbourhoodCount(int cell) {
+		int cx = cell % gridWidth;
+		int cy = cell / gridWidth;
+		int count = 0;
+		for (int y = std::max(0, cy - 1); y <= std::min(gridHeight - 1, cy + 1); y++)
+			for (int x = std::max(0, cx - 1); x <= std::min(gridWidth - 1, cx + 1); x++)
+				count += cellCounts[y * gridWidth + x];
+		return count;
+	}
+
+	///<summary>Labels every cell connected to the seed cell. Only cells that pass the expand
+	///test spread the label further; the rest join the cluster as its border.</summary>
+	template <class ExpandTest>
+	void flood(int seed, int label, ExpandTest expand) {
+		std::vector<int> frontier;
+		cellLabels[seed] = label;
+		frontier.push_back(seed);
+		while (!frontier.empty()) {
+			int cell = frontier.back();
+			frontier.pop_back();
+			int cx = cell % gridWidth;
+			int cy = cell / gridWidth;
+			for (int y = std::max(0, cy - 1); y <= std::min(gridHeight - 1, cy + 1); y++) {
+				for (int x = std::max(0, cx - 1); x <= std::min(gridWidth - 1, cx + 1); x++) {
+					int n = y * gridWidth + x;
+					if (cellStamps[n] != clusteringPass || cellLabels[n] != -1)
+						continue; //unoccupied or already labeled
+					cellLabels[n] = label;
+					if (expand(n))
+						frontier.push_back(n);
+				}
+			}
+		}
+	}
+
+	///<summary>Grid-based DBSCAN over the occupied cells. Returns the number of clusters found.</summary>
+	int cluster() {
+		clusteringPass++;
+		std::vector<int> occupied;
+		for (auto &m : members) {
+			int cell = m.second.cell;
+			if (cellStamps[cell] != clusteringPass) {
+				cellStamps[cell] = clusteringPass;
+				cellLabels[cell] = -1;
+				occupied.push_back(cell);
+			}
+		}
+
+		int labels = 0;
+		//dense cells seed clusters and spread through other dense cells
+		for (int cell : occupied) {
+			if (cellLabels[cell] != -1 || neighbourhoodCount(cell) < SQUAD_MIN_UNITS)
+				continue;
+			flood(cell, labels++, [](int n) { return neighbourhoodCount(n) >= SQUAD_MIN_UNITS; });
+		}
+		//what's left is noise; stragglers that touch each other still move together
+		for (int cell : occupied) {
+			if (cellLabels[cell] != -1)
+				continue;
+			flood(cell, labels++, [](int n) { return true; });
+		}
+		return labels;
+	}
+
+	///<summary>Rebuilds the squad list from fresh cluster labels. A cluster inherits the id and
+	///objective of the old squad most of its members came from, so objectives survive units
+	///drifting between cells.</summary>
+	void rebuildSquads(int labels) {
+		std::vector<Squad> previous;
+		previous.swap(squads);
+
+		//count how many members of each new cluster came from each old squad
+		std::map<std::pair<int, int>, int> tally;
+		for (auto &m : members) {
+			if (m.second.squadId >= 0)
+				tally[std::make_pair(cellLabels[m.second.cell], m.second.squadId)]++;
+		}
+		std::vector<std::pair<int, std::pair<int, int>>> claims;
+		for (auto &t : tally)
+			claims.push_back(std::make_pair(t.second, t.first));
+		std::sort(claims.begin(), claims.end(), [](const std::pair<int, std::pair<int, int>> &a, const std::pair<int, std::pair<int, int>> &b) {
+			return a.first > b.first;
+		});
+
+		squads.resize(labels);
+		for (auto &squad : squads) {
+			squad.id = -1;
+			squad.objective = Positions::None;
+		}
+		std::vector<int> claimedIds;
+		for (auto &c : claims) {
+			Squad &squad = squads[c.second.first];
+			int oldId = c.second.second;
+			if (squad.id != -1 || std::find(claimedIds.begin(), claimedIds.end(), oldId) != claimedIds.end())
+				continue;
+			squad.id = oldId;
+			claimedIds.push_back(oldId);
+			for (auto &old : previous) {
+				if (old.id == oldId)
+					squad.objective = old.objective;
+			}
+		}
+		for (auto &squad : squads) {
+			if (squad.id == -1)
+				squad.id = nextSquadId++;
+		}
+
+		for (auto &m : members) {
+			int label = cellLabels[m.second.cell];
+			squads[label].units.insert(m.first);
+			m.second.squadIndex = label;
+			m.second.squadId = squads[label].id;
+		}
+	}
+
+	///<summary>Brings squad membership up to date with the specified army. Only units that
+	///crossed into another cell touch the grid, and clustering is only redone when one did
+	///or when the army changed.</summary>
+	void update(const Unitset &army) {
+		initGrid();
+		updateCount++;
+		bool changed = false;
+
+		for (auto &u : army) {
+			int cell = cellOf(u->getPosition());
+			auto it = members.find(u);
+			if (it == members.end()) {
+				Member m;
+				m.cell = cell;
+				m.squadIndex = -1;
+				m.squadId = -1;
+				it = members.insert(std::make_pair(u, m)).first;
+				cellCounts[cell]++;
+				changed = true;
+			}
+			else if (it->second.cell != cell) {
+				cellCounts[it->second.cell]--;
+				cellCounts[cell]++;
+				it->second.cell = cell;
+				changed = true;
+			}
+			it->second.lastUpdate = updateCount;
+		}
+
+		//drop units that have left the army
+		auto it = members.begin();
+		while (it != members.end()) {
+			if (it->second.lastUpdate != updateCount) {
+				cellCounts[it->second.cell]--;
+				it = members.erase(it);
+				changed = true;
+				continue;
+			}
+			it++;
+		}
+
+		if (changed)
+			rebuildSquads(cluster());
+
+		for (auto &squad : squads)
+			squad.centroid = squad.units.getPosition();
+	}
+
+	std::vector<Squad> &getSquads() {
+		return squads;
+	}
+
+	const Squad *getSquadOf(Unit unit) {
+		auto it = members.find(unit);
+		if (it == members.end() || it->second.squadIndex < 0)
+			return nullptr;
+		return &squads[it->second.squadIndex];
+	}
+
+	///<summary>Returns the average position of all squadded units, computed from squad centroids.</summary>
+	Position getCentroid() {
+		int x = 0;
+		int y = 0;
+		int count = 0;
+		for (auto &squad : squads) {
+			x += squad.centroid.x * (int)squad.units.size();
+			y += squad.centroid.y * (int)squad.units.size();
+			count += squad.units.size();
+		}
+		if (count == 0)
+			return Positions::None;
+		return Position(x / count, y / count);
+	}
+
+	int getUnitCount() {
+		return (int)members.size();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <unordered_map>
+
+#include "Shared.h"
+
+//side length, in tiles, of a squad clustering cell; units in neighbouring cells fight as one group
+#define SQUAD_CELL_TILES 6
+//units needed in a cell and its neighbours for that cell to anchor a squad
+#define SQUAD_MIN_UNITS 3
+
+namespace Squads {
+
+	typedef struct Squad_t {
+		//identifier that persists while the squad keeps most of its members
+		int id;
+		//the units in the squad
+		BWAPI::Unitset units;
+		//average position of the squad's units
+		BWAPI::Position centroid;
+		//where the squad has been told to go, or Positions::None if it hasn't been given an objective
+		BWAPI::Position objective;
+	} Squad;
+
+	void update(const BWAPI::Unitset &army);
+	std::vector<Squad> &getSquads();
+	const Squad *getSquadOf(BWAPI::Unit unit);
+	BWAPI::Position getCentroid();
+	int getUnitCount();
+
+}
\ No newline at end of file
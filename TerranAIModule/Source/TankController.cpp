@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <unordered_map>
+
+#include "TankController.h"
+#include "Prediction.h"
+#include "Squads.h"
+#include "CommandDispatcher.h"
+
+using namespace BWAPI;
+
+namespace TankController {
+
+	enum Decision {
+		HOLD,
+		SIEGE,
+		//an enemy is inside our minimum range; no use staying sieged
+		UNSIEGE,
+		//nothing left in range; pack up once the rest of the group can cover us
+		PACK_UP
+	};
+
+	typedef struct Tank_t {
+		BWAPI::Unit unit;
+		//where the tank will be when this evaluation's orders take effect
+		BWAPI::Position position;
+		//squad ID, or -1 - unit ID for tanks outside a squad
+		int group;
+		//how far the tank is from its squad's objective, or 0 if it has none
+		int objectiveDistance;
+		bool sieged;
+		Decision decision;
+	} Tank;
+
+	//a visible ground enemy, at where it will be when this evaluation's orders take effect
+	typedef struct IndexedEnemy_t {
+		int cell;
+		BWAPI::Position position;
+	} IndexedEnemy;
+
+	//ground enemies sorted by cell, shared by every tank's range checks
+	static std::vector<IndexedEnemy> enemies;
+	//width of an index cell; anything within this of a point is in its cell or the eight around it
+	static int cellSize = 1;
+	//frame on which each group last had tanks pack up
+	static std::unordered_map<int, int> lastPackUpFrame;
+
+	int cellKey(Position pos) {
+		return (pos.y / cellSize) * 1024 + pos.x / cellSize;
+	}
+
+	///<summary>Rebuilds the enemy index from the ground enemies our tanks could fire on.</summary>
+	void indexEnemies(int delay) {
+		Unitset targets;
+		for (auto &player : Broodwar->enemies()) {
+			for (auto &u : player->getUnits()) {
+				if (!u->exists() || u->isFlying() || ((u->isCloaked() || u->isBurrowed()) && !u->isDetected()))
+					continue;
+				targets.insert(u);
+			}
+		}
+		std::vector<Position> positions;
+		Prediction::predictPositions(targets, delay, positions);
+		enemies.clear();
+		for (auto &p : positions) {
+			if (p == Positions::None)
+				continue;
+			IndexedEnemy e = { cellKey(p), p };
+			enemies.push_back(e);
+		}
+		std::sort(enemies.begin(), enemies.end(), [](const IndexedEnemy &a, const IndexedEnemy &b) { return a.cell < b.cell; });
+	}
+
+	///<summary>Returns the distance from pos to the closest indexed enemy, or 99999 if none is
+	///within cellSize.</summary>
+	int closestEnemyDistance(Position pos) {
+		int closest = 99999;
+		int cx = pos.x / cellSize;
+		int cy = pos.y / cellSize;
+		for (int dy = -1; dy <= 1; dy++) {
+			for (int dx = -1; dx <= 1; dx++) {
+				if (cx + dx < 0 || cy + dy < 0)
+					continue;
+				int key = (cy + dy) * 1024 + cx + dx;
+				auto first = std::lower_bound(enemies.begin(), enemies.end(), key, [](const IndexedEnemy &e, int k) { return e.cell < k; });
+				for (auto it = first; it != enemies.end() && it->cell == key; it++)
+					closest = std::min(closest, (int)it->position.getDistance(pos));
+			}
+		}
+		return closest;
+	}
+
+	///<summary>Lets a group's tanks pack up a few at a time, rearmost first, so there are always
+	///sieged tanks covering the ones on the move. With no other tank left fighting, half of
+	///those packing up go at once and the rest wait TANK_STAGGER_FRAMES; the group halves again
+	///each round until the last tank goes.</summary>
+	void staggerPackUp(std::vector<Tank*> &group, int frame) {
+		std::vector<Tank*> packing;
+		int sieged = 0;
+		for (auto t : group) {
+			if (t->sieged && t->decision != UNSIEGE)
+				sieged++;
+			if (t->decision == PACK_UP)
+				packing.push_back(t);
+		}
+		if (packing.empty())
+			return;
+		int groupId = group.front()->group;
+		auto last = lastPackUpFrame.find(groupId);
+		bool waiting = last != lastPackUpFrame.end() && frame - last->second < TANK_STAGGER_FRAMES;
+		//tanks still fighting cover everyone packing; otherwise the first half covers the second
+		int allowed = waiting ? 0 : (sieged > (int)packing.size() ? (int)packing.size() : ((int)packing.size() + 1) / 2);
+		std::sort(packing.begin(), packing.end(), [](const Tank *a, const Tank *b) { return a->objectiveDistance > b->objectiveDistance; });
+		for (int i = 0; i < (int)packing.size(); i++) {
+			if (i >= allowed)
+				packing[i]->decision = HOLD;
+		}
+		if (allowed > 0)
+			lastPackUpFrame[groupId] = frame;
+	}
+
+	///<summary>Decides every tank's mode in one pass. Tanks and enemies are both judged where
+	///they'll be when the orders take effect; a tank sieges when the closest enemy will be in
+	///its siege range band and unsieges when one gets under its minimum range or none is left
+	///in range, with packing up staggered across the tank's squad.</summary>
+	void update() {
+		Unitset units;
+		for (auto &u : Broodwar->self()->getUnits()) {
+			if (u->exists() && u->isCompleted() && !u->isLoaded() &&
+				(u->getType() == UnitTypes::Terran_Siege_Tank_Tank_Mode || u->getType() == UnitTypes::Terran_Siege_Tank_Siege_Mode))
+				units.insert(u);
+		}
+		if (units.empty())
+			return;
+
+		//the bands are the same for every tank, so work them out once
+		WeaponType weapon = UnitTypes::Terran_Siege_Tank_Siege_Mode.groundWeapon();
+		int maxRange = Broodwar->self()->weaponMaxRange(weapon);
+		int minRange = weapon.minRange();
+		int siegeRange = maxRange + TANK_SIEGE_LEAD;
+		int unsiegeRange = maxRange + TANK_UNSIEGE_MARGIN;
+		int delay = Prediction::getCommandDelay();
+		cellSize = unsiegeRange;
+		indexEnemies(delay);
+
+		std::vector<Position> positions;
+		Prediction::predictPositions(units, delay, positions);
+		std::vector<Tank> tanks;
+		tanks.reserve(units.size());
+		int i = 0;
+		for (auto &u : units) {
+			Tank t;
+			t.unit = u;
+			t.position = positions[i++];
+			const Squads::Squad *squad = Squads::getSquadOf(u);
+			t.group = squad ? squad->id : -1 - u->getID();
+			t.objectiveDistance = squad && squad->objective != Positions::None ? t.position.getApproxDistance(squad->objective) : 0;
+			t.sieged = u->getType() == UnitTypes::Terran_Siege_Tank_Siege_Mode;
+			int closest = closestEnemyDistance(t.position);
+			if (!t.sieged && closest <= siegeRange && closest > minRange)
+				t.decision = SIEGE;
+			else if (t.sieged && closest <= minRange)
+				t.decision = UNSIEGE;
+			else if (t.sieged && closest > unsiegeRange)
+				t.decision = PACK_UP;
+			else
+				t.decision = HOLD;
+			tanks.push_back(t);
+		}
+
+		std::sort(tanks.begin(), tanks.end(), [](const Tank &a, const Tank &b) { return a.group < b.group; });
+		int frame = Broodwar->getFrameCount();
+		std::vector<Tank*> group;
+		for (size_t j = 0; j <= tanks.size(); j++) {
+			if (j == tanks.size() || (!group.empty() && tanks[j].group != group.front()->group)) {
+				staggerPackUp(group, frame);
+				group.clear();
+			}
+			if (j < tanks.size())
+				group.push_back(&tanks[j]);
+		}
+
+		Unitset sieging;
+		Unitset unsieging;
+		for (auto &t : tanks) {
+			if (t.decision == SIEGE)
+				sieging.insert(t.unit);
+			else if (t.decision == UNSIEGE || t.decision == PACK_UP)
+				unsieging.insert(t.unit);
+		}
+		if (!sieging.empty())
+			CommandDispatcher::issue(sieging, UnitCommand::siege(nullptr));
+		if (!unsieging.empty())
+			CommandDispatcher::issue(unsieging, UnitCommand::unsiege(nullptr));
+	}
+
+	void clear() {
+		enemies.clear();
+		lastPackUpFrame.clear();
+	}
+
+}
\ No newline at end of file
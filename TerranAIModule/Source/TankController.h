@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Shared.h"
+
+//distance beyond siege range at which tanks start sieging, so they're set up by the time the enemy arrives
+#define TANK_SIEGE_LEAD (2 * TILE_SIZE)
+//distance beyond siege range the closest enemy must be before sieged tanks pack up; keeps tanks
+//from flickering between modes at the edge of their range
+#define TANK_UNSIEGE_MARGIN (3 * TILE_SIZE)
+//frames after some of a group's tanks pack up before the rest may; about the time it takes
+//to unsiege and get moving
+#define TANK_STAGGER_FRAMES (24 * 3)
+
+namespace TankController {
+
+	void update();
+	void clear();
+
+}
\ No newline at end of file
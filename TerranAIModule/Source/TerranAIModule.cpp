@@ -1,6 +1,19 @@
 #include <iostream>
 
 #include "TerranAIModule.h"
+#include "ThreadPool.h"
+#include "CommandDispatcher.h"
+#include "Commandability.h"
+#include "EventScheduler.h"
+#include "DamageMatrix.h"
+#include "AllocationTracker.h"
+#include "Regression.h"
+#include "FogMemory.h"
+#include "ScanPlanner.h"
+#include "TankController.h"
+#include "RegionGraph.h"
+#include "PathFinder.h"
+#include "Trace.h"
 
 using namespace BWAPI;
 using namespace Filter;
@@ -10,6 +23,11 @@ using namespace MilitaryManager;
 
 void TerranAIModule::onStart()
 {
+	//fix the seed and thread count first when measuring against the regression baseline
+	Regression::start();
+	//ground distances between every pair of regions, for choosing rally points
+	RegionGraph::init();
+
 	//print the map name
 	Broodwar << "The map is " << Broodwar->mapName() << "!" << std::endl;
 
@@ -49,10 +67,27 @@ void TerranAIModule::onEnd(bool isWinner)
 	{
 		// Log your win here!
 	}
+	//join worker threads first, so nothing they're still finishing sees the state below torn down,
+	//and now rather than during DLL unload
+	ThreadPool::shutdownShared();
+	EventScheduler::clear();
+	DamageMatrix::clear();
+	FogMemory::clear();
+	ScanPlanner::clear();
+	TankController::clear();
+	RegionGraph::clear();
+	PathFinder::clear();
+	Regression::finish();
+	Trace::dump();
+	Trace::clear();
 }
 
 void TerranAIModule::onFrame()
 {
+	//the previous frame has ended by now, so its time is known
+	Regression::recordFrame(Trace::getLastFrameMilliseconds());
+	Trace::FrameScope traceFrame(Broodwar->getFrameCount());
+	Regression::update();
 
 	if (Broodwar->self()->getRace().getName() != "Terran")
 		return; //we don't know how to handle any race other than terran
@@ -63,10 +98,18 @@ void TerranAIModule::onFrame()
 	Broodwar->drawTextScreen(300, 0, "FPS: %d", Broodwar->getFPS());
 	Broodwar->drawTextScreen(300, 20, "Average FPS: %f", Broodwar->getAverageFPS());
 
+	// Run the debug overlays scheduled on earlier frames
+	TRACE_CALL("EventScheduler::update", EventScheduler::update());
+
 	// Return if the game is a replay or is paused
 	if (Broodwar->isReplay() || Broodwar->isPaused() || !Broodwar->self())
 		return;
 
+	// Keep track of where we've looked; this is spread over frames, so it runs on every one
+	TRACE_CALL("FogMemory::update", FogMemory::update());
+	// Deliver finished path searches and start the next batch
+	TRACE_CALL("PathFinder::update", PathFinder::update());
+
 	/* Prevent spamming by only running onFrame once every number of latency frames.
 	Latency frames are the number of frames before commands are processed. This has
 	the added benefit of not accidentally issuing unnecessary orders as a result of
@@ -74,12 +117,17 @@ void TerranAIModule::onFrame()
 	if (Broodwar->getFrameCount() % Broodwar->getLatencyFrames() != 0)
 		return;
 
-	evaluateGoals();
-	validateUnits();
-	moveToRally();
-	evaluatePreparedness();
-	executeTactic();
-	evaluateStrategy();
+	TRACE_CALL("EnemyMemory::update", EnemyMemory::update());
+	TRACE_CALL("DamageMatrix::update", DamageMatrix::update());
+	TRACE_CALL("ScanPlanner::update", ScanPlanner::update());
+	TRACE_CALL("evaluateGoals", evaluateGoals());
+	TRACE_CALL("validateUnits", validateUnits());
+	TRACE_CALL("moveToRally", moveToRally());
+	TRACE_CALL("evaluatePreparedness", evaluatePreparedness());
+	TRACE_CALL("executeTactic", executeTactic());
+	TRACE_CALL("evaluateStrategy", evaluateStrategy());
+	// after the squad orders, so a tank's siege or unsiege replaces its squad's move this frame
+	TRACE_CALL("TankController::update", TankController::update());
 
 	int enqueuedSupplyDepots = 0;
 	int requiredSupplyDepots = 0;
@@ -108,7 +156,7 @@ void TerranAIModule::onFrame()
 	resourceProjection unallocatedResources = getUnallocatedResources();
 
 	//draw information to screen until the next time it's evaluated
-	Broodwar->registerEvent([unallocatedResources](Game*) {
+	EventScheduler::schedule([unallocatedResources]() {
 		int ypos = 20;
 		Broodwar->drawTextScreen(20, 0, "Goals:");
 		for (Goal &g : getGoals()) {
@@ -119,8 +167,26 @@ void TerranAIModule::onFrame()
 		Broodwar->drawTextScreen(20, ypos, "Unallocated minerals: %d", unallocatedResources.minerals);
 		ypos += 20;
 		Broodwar->drawTextScreen(20, ypos, "Unallocated gas: %d", unallocatedResources.gas);
+		ypos += 20;
+		const CommandDispatcher::CommandCounts &commands = CommandDispatcher::getFrameCounts();
+		Broodwar->drawTextScreen(20, ypos, "Commands: %d sent, %d suppressed, %d grouped; APM %d",
+			commands.issued, commands.suppressed, commands.coalesced, CommandDispatcher::getActionsPerMinute());
+		ypos += 20;
+		const Commandability::CommandabilityCounts &checks = Commandability::getFrameCounts();
+		Broodwar->drawTextScreen(20, ypos, "Command checks: %d, %d ruled out by type, %d memoized",
+			checks.checks, checks.rejectedByType, checks.memoHits);
+		ypos += 20;
+		Broodwar->drawTextScreen(20, ypos, "Damage matrix entries rebuilt: %d", DamageMatrix::getRebuiltEntries());
+		if (AllocationTracker::isEnabled()) {
+			AllocationTracker::ScopeAllocations allocations[5];
+			int scopes = AllocationTracker::getFrameReport(allocations, 5);
+			for (int i = 0; i < scopes; i++) {
+				ypos += 20;
+				Broodwar->drawTextScreen(20, ypos, "Allocations in %s: %d (%lld bytes)",
+					allocations[i].scope, allocations[i].allocations, allocations[i].bytes);
+			}
+		}
 	},
-		nullptr,    // condition
 		Broodwar->getLatencyFrames());  // frames to run
 
 	// iterate through all the units that we own for the sake of issuing orders to them
@@ -134,32 +200,36 @@ void TerranAIModule::onFrame()
 		//if the unit is a worker
 		if (u->getType().isWorker())
 		{
-			evaluateWorkerLogicFor(u, requiredSupplyDepots, workerCount);
+			TRACE_CALL("evaluateWorkerLogicFor", evaluateWorkerLogicFor(u, requiredSupplyDepots, workerCount));
 		}
 
 		//if the unit is a townhall
 		if (u->getType().isResourceDepot()) {
-			evaluateTownhallLogicFor(u, workerCount);
+			TRACE_CALL("evaluateTownhallLogicFor", evaluateTownhallLogicFor(u, workerCount));
 		}
 
 		//if the unit is a refinery
 		if (u->getType().isRefinery()) {
-			evaluateRefineryLogicFor(u, workerCount);
+			TRACE_CALL("evaluateRefineryLogicFor", evaluateRefineryLogicFor(u, workerCount));
 		}
 
 		if (u->getType() == UnitTypes::Terran_Barracks) {
 			//only build medics and firebats against Zerg - useless against Terran
 			//and niche at best against Protoss
 			bool enemyIsZerg = (Broodwar->enemy()->getRace().getName() == "Zerg");
-			evaluateBarracksLogicFor(u, enemyIsZerg, enemyIsZerg);
+			TRACE_CALL("evaluateBarracksLogicFor", evaluateBarracksLogicFor(u, enemyIsZerg, enemyIsZerg));
 		}
 
 		if (u->getType() == UnitTypes::Terran_Factory) {
-			evaluateFactoryLogicFor(u);
+			TRACE_CALL("evaluateFactoryLogicFor", evaluateFactoryLogicFor(u));
 		}
 
-		evaluateAbilityLogicFor(u);
+		TRACE_CALL("evaluateAbilityLogicFor", evaluateAbilityLogicFor(u));
 	}
+
+	//send this frame's orders, grouped where possible
+	TRACE_CALL("CommandDispatcher::flush", CommandDispatcher::flush());
+	Regression::recordCommands(CommandDispatcher::getFrameCounts());
 }
 
 void TerranAIModule::onSendText(std::string text)
@@ -189,6 +259,9 @@ void TerranAIModule::onNukeDetect(BWAPI::Position target)
 //Called when the Unit interface object representing the unit that has just become accessible.
 void TerranAIModule::onUnitDiscover(BWAPI::Unit unit)
 {
+	//a building we hadn't known about is in the way of ground paths now
+	PathFinder::onUnitCreate(unit);
+
 	//if we own this unit
 	if (unit->getPlayer() == Broodwar->self()) {
 		//and it's a military unit
@@ -197,10 +270,6 @@ void TerranAIModule::onUnitDiscover(BWAPI::Unit unit)
 			addToArmy(unit);
 		}
 	}
-
-	//if it's an enemy unit, index it
-	if (unit->getPlayer()->isEnemy(Broodwar->self()))
-		indexEnemyUnit(unit);
 }
 
 //Called when the Unit interface object representing the unit that has just become inaccessible.
@@ -211,11 +280,13 @@ void TerranAIModule::onUnitEvade(BWAPI::Unit unit)
 //Called when a previously invisible unit becomes visible.
 void TerranAIModule::onUnitShow(BWAPI::Unit unit)
 {
+	EnemyMemory::onUnitShow(unit);
 }
 
 //Called just as a visible unit is becoming invisible.
 void TerranAIModule::onUnitHide(BWAPI::Unit unit)
 {
+	EnemyMemory::onUnitHide(unit);
 }
 
 void TerranAIModule::onUnitCreate(BWAPI::Unit unit)
@@ -235,10 +306,15 @@ void TerranAIModule::onUnitCreate(BWAPI::Unit unit)
 
 void TerranAIModule::onUnitDestroy(BWAPI::Unit unit)
 {
+	EnemyMemory::onUnitDestroy(unit);
+	PathFinder::onUnitDestroy(unit);
 }
 
 void TerranAIModule::onUnitMorph(BWAPI::Unit unit)
 {
+	EnemyMemory::onUnitMorph(unit);
+	PathFinder::onUnitCreate(unit);
+
 	if (Broodwar->isReplay())
 	{
 		// if we are in a replay, then we will print out the build order of the structures
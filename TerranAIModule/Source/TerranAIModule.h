@@ -3,6 +3,7 @@
 #include "Shared.h"
 #include "UnitBehavior.h"
 #include "MilitaryManager.h"
+#include "EnemyMemory.h"
 
 class TerranAIModule : public BWAPI::AIModule
 {
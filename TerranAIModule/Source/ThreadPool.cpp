@@ -0,0 +1,73 @@
+#include "ThreadPool.h"
+
+static ThreadPool *sharedPool = nullptr;
+//size of the shared pool when it's next created; zero or less sizes it to the machine
+static int sharedThreadCount = 0;
+
+ThreadPool::ThreadPool(int threadCount)
+{
+	//by default, leave one core for the game thread
+	if (threadCount <= 0)
+		threadCount = (int)std::thread::hardware_concurrency() - 1;
+	if (threadCount < 1)
+		threadCount = 1;
+	this->stopping = false;
+	for (int i = 0; i < threadCount; i++)
+		this->workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+}
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->taskMutex);
+		this->stopping = true;
+	}
+	this->taskAvailable.notify_all();
+	for (auto &worker : this->workers)
+		worker.join();
+}
+void ThreadPool::enqueue(std::function<void()> task)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->taskMutex);
+		this->tasks.push_back(task);
+	}
+	this->taskAvailable.notify_one();
+}
+int ThreadPool::getThreadCount() const
+{
+	return (int)this->workers.size();
+}
+void ThreadPool::workerLoop()
+{
+	while (true)
+	{
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(this->taskMutex);
+			this->taskAvailable.wait(lock, [this]() { return this->stopping || !this->tasks.empty(); });
+			if (this->stopping && this->tasks.empty())
+				return;
+			task = this->tasks.front();
+			this->tasks.pop_front();
+		}
+		task();
+	}
+}
+ThreadPool &ThreadPool::getShared()
+{
+	//created on first use and torn down explicitly from onEnd; joining threads from a
+	//static destructor during DLL unload would deadlock on the loader lock
+	if (!sharedPool)
+		sharedPool = new ThreadPool(sharedThreadCount);
+	return *sharedPool;
+}
+void ThreadPool::shutdownShared()
+{
+	delete sharedPool;
+	sharedPool = nullptr;
+}
+void ThreadPool::setSharedThreadCount(int threadCount)
+{
+	//a pool that's already running keeps its threads until it's shut down
+	sharedThreadCount = threadCount;
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <vector>
+
+class ThreadPool
+{
+public:
+	ThreadPool(int threadCount = 0);
+	~ThreadPool();
+	void enqueue(std::function<void()> task);
+	int getThreadCount() const;
+	static ThreadPool &getShared();
+	static void shutdownShared();
+	static void setSharedThreadCount(int threadCount);
+private:
+	ThreadPool(const ThreadPool&);
+	ThreadPool &operator=(const ThreadPool&);
+	void workerLoop();
+	std::vector<std::thread> workers;
+	std::deque<std::function<void()>> tasks;
+	std::mutex taskMutex;
+	std::condition_variable taskAvailable;
+	bool stopping;
+};
\ No newline at end of file
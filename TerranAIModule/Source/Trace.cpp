@@ -0,0 +1,233 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include "Trace.h"
+#include "AllocationTracker.h"
+
+namespace Trace {
+
+	typedef struct Event_t {
+		//must outlive the game; trace points only ever pass string literals
+		const char *name;
+		long long ticks;
+		//'B' or 'E', as in Chrome's trace_event format
+		char phase;
+	} Event;
+
+	//one thread's most recent events; only that thread writes to it
+	typedef struct Buffer_t {
+		Event events[TRACE_BUFFER_EVENTS];
+		//events ever written; the next one goes to written % TRACE_BUFFER_EVENTS
+		std::atomic<unsigned int> written;
+		//value of written when the current frame began
+		unsigned int frameStart;
+		//index of the thread in the dump
+		int thread;
+		bool isGameThread;
+	} Buffer;
+
+	//an event copied out of a buffer, tagged with the thread it came from
+	typedef struct SavedEvent_t {
+		Event event;
+		int thread;
+	} SavedEvent;
+
+	typedef struct SavedFrame_t {
+		int frame;
+		long long startTicks;
+		long long durationTicks;
+		std::vector<SavedEvent> events;
+	} SavedFrame;
+
+	static TRACE_THREAD_LOCAL Buffer *localBuffer = nullptr;
+	//names of the scopes this thread is inside, innermost last
+	static TRACE_THREAD_LOCAL const char *scopeStack[TRACE_MAX_DEPTH];
+	static TRACE_THREAD_LOCAL int scopeDepth = 0;
+	//every thread's buffer; buffers are never freed, since threads hold on to them
+	static std::vector<std::unique_ptr<Buffer>> buffers;
+	static std::mutex buffersMutex;
+	static std::vector<SavedFrame> worstFrames;
+	static int currentFrame = -1;
+	static long long frameStartTicks = 0;
+	//how long the last complete frame took, or -1 before the first one ends
+	static long long lastFrameTicks = -1;
+
+	long long now() {
+#ifdef _WIN32
+		//std::chrono's clocks only tick once a millisecond on VS2013
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+		return counter.QuadPart;
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	double ticksPerMicrosecond() {
+#ifdef _WIN32
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+		return frequency.QuadPart / 1e6;
+#else
+		return 1e3;
+#endif
+	}
+
+	Buffer &getLocalBuffer() {
+		if (!localBuffer) {
+			std::unique_ptr<Buffer> buffer(new Buffer());
+			buffer->written = 0;
+			buffer->frameStart = 0;
+			buffer->isGameThread = false;
+			std::lock_guard<std::mutex> lock(buffersMutex);
+			buffer->thread = (int)buffers.size();
+			localBuffer = buffer.get();
+			buffers.push_back(std::move(buffer));
+		}
+		return *localBuffer;
+	}
+
+	void record(const char *name, char phase) {
+		Buffer &b = getLocalBuffer();
+		unsigned int index = b.written.load(std::memory_order_relaxed);
+		Event &e = b.events[index % TRACE_BUFFER_EVENTS];
+		e.name = name;
+		e.ticks = now();
+		e.phase = phase;
+		b.written.store(index + 1, std::memory_order_release);
+	}
+
+	void begin(const char *name) {
+		if (scopeDepth < TRACE_MAX_DEPTH)
+			scopeStack[scopeDepth] = name;
+		scopeDepth++;
+		record(name, 'B');
+	}
+
+	void end(const char *name) {
+		record(name, 'E');
+		scopeDepth--;
+	}
+
+	///<summary>Returns the name of the innermost scope the calling thread is in, or nullptr.
+	///Doesn't allocate, so it's safe to call from operator new.</summary>
+	const char *getCurrentScope() {
+		if (scopeDepth <= 0)
+			return nullptr;
+		return scopeStack[std::min(scopeDepth, TRACE_MAX_DEPTH) - 1];
+	}
+
+	///<summary>Starts a game frame. Called on the game thread, which is the only thread whose
+	///events mark frame boundaries.</summary>
+	void beginFrame(int frame) {
+		getLocalBuffer().isGameThread = true;
+		{
+			std::lock_guard<std::mutex> lock(buffersMutex);
+			for (auto &b : buffers)
+				b->frameStart = b->written.load(std::memory_order_acquire);
+		}
+		currentFrame = frame;
+		frameStartTicks = now();
+		begin("onFrame");
+	}
+
+	///<summary>Ends the game frame. If it was one of the slowest so far, every thread's events
+	///since the frame began are copied out of the ring buffers; otherwise nothing is copied.
+	///Events from a thread that wrote more than a buffer's worth during the frame are cut to
+	///the most recent TRACE_BUFFER_EVENTS.</summary>
+	void endFrame() {
+		end("onFrame");
+		AllocationTracker::endFrame();
+		long long duration = now() - frameStartTicks;
+		lastFrameTicks = duration;
+		auto fastest = std::min_element(worstFrames.begin(), worstFrames.end(), [](const SavedFrame &a, const SavedFrame &b) {
+			return a.durationTicks < b.durationTicks;
+		});
+		if (worstFrames.size() >= TRACE_WORST_FRAMES && fastest->durationTicks >= duration)
+			return;
+
+		SavedFrame *saved;
+		if (worstFrames.size() < TRACE_WORST_FRAMES) {
+			worstFrames.push_back(SavedFrame());
+			saved = &worstFrames.back();
+		}
+		else {
+			saved = &*fastest;
+		}
+		saved->frame = currentFrame;
+		saved->startTicks = frameStartTicks;
+		saved->durationTicks = duration;
+		saved->events.clear();
+
+		std::lock_guard<std::mutex> lock(buffersMutex);
+		for (auto &b : buffers) {
+			unsigned int last = b->written.load(std::memory_order_acquire);
+			unsigned int first = std::max(b->frameStart, last - std::min(last, (unsigned int)TRACE_BUFFER_EVENTS));
+			for (unsigned int i = first; i != last; i++) {
+				SavedEvent e = { b->events[i % TRACE_BUFFER_EVENTS], b->thread };
+				saved->events.push_back(e);
+			}
+		}
+	}
+
+	///<summary>Returns how long the last complete frame took, or -1 if none has ended yet.
+	///Frames are timed whether or not TRACE_ENABLED is set.</summary>
+	double getLastFrameMilliseconds() {
+		if (lastFrameTicks < 0)
+			return -1.0;
+		return lastFrameTicks / ticksPerMicrosecond() / 1000.0;
+	}
+
+	///<summary>Writes the slowest frames to TRACE_OUTPUT_FILE in Chrome's trace_event format,
+	///for chrome://tracing or Perfetto. Each frame is shown as its own process, with time
+	///measured from the start of that frame.</summary>
+	void dump() {
+		if (worstFrames.empty())
+			return;
+		FILE *f = fopen(TRACE_OUTPUT_FILE, "wt");
+		if (!f)
+			return;
+		double perMicrosecond = ticksPerMicrosecond();
+		std::sort(worstFrames.begin(), worstFrames.end(), [](const SavedFrame &a, const SavedFrame &b) {
+			return a.frame < b.frame;
+		});
+
+		fprintf(f, "{\"traceEvents\":[\n");
+		bool first = true;
+		for (auto &frame : worstFrames) {
+			fprintf(f, "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"frame %d (%.2f ms)\"}}",
+				first ? "" : ",\n", frame.frame, frame.frame, frame.durationTicks / perMicrosecond / 1000.0);
+			first = false;
+			std::lock_guard<std::mutex> lock(buffersMutex);
+			for (auto &b : buffers) {
+				//only name the threads that did something during this frame
+				if (std::none_of(frame.events.begin(), frame.events.end(), [&b](const SavedEvent &e) { return e.thread == b->thread; }))
+					continue;
+				fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s %d\"}}",
+					frame.frame, b->thread, b->isGameThread ? "game" : "worker", b->thread);
+			}
+			for (auto &e : frame.events) {
+				fprintf(f, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f}",
+					e.event.name, e.event.phase, frame.frame, e.thread, (e.event.ticks - frame.startTicks) / perMicrosecond);
+			}
+		}
+		fprintf(f, "\n]}\n");
+		fclose(f);
+	}
+
+	///<summary>Forgets the saved frames. Buffers are kept, since threads still point at them.</summary>
+	void clear() {
+		worstFrames.clear();
+		currentFrame = -1;
+		lastFrameTicks = -1;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Shared.h"
+
+//set to 0 to compile every trace point out
+#define TRACE_ENABLED 1
+//begin and end events each thread keeps before the oldest are overwritten
+#define TRACE_BUFFER_EVENTS 32768
+//slowest frames kept for the dump at the end of the game
+#define TRACE_WORST_FRAMES 8
+//deepest nesting of scopes on one thread that getCurrentScope keeps track of
+#define TRACE_MAX_DEPTH 64
+//where the worst frames are written, relative to the StarCraft folder
+#define TRACE_OUTPUT_FILE "bwapi-data/write/trace.json"
+
+#ifdef _MSC_VER
+#define TRACE_THREAD_LOCAL __declspec(thread)
+#else
+#define TRACE_THREAD_LOCAL __thread
+#endif
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+#if TRACE_ENABLED
+//records the rest of the enclosing block as a span with the specified name, which must be a string literal
+#define TRACE_SCOPE(name) Trace::Scope TRACE_CONCAT(traceScope, __LINE__)(name)
+//records a single call, such as a spatial query, as a span; evaluates to the call's result
+#define TRACE_CALL(name, call) (Trace::Scope(name), (call))
+#else
+#define TRACE_SCOPE(name)
+#define TRACE_CALL(name, call) (call)
+#endif
+
+namespace Trace {
+
+	void begin(const char *name);
+	void end(const char *name);
+	void beginFrame(int frame);
+	void endFrame();
+	void dump();
+	void clear();
+	const char *getCurrentScope();
+	double getLastFrameMilliseconds();
+
+	//a span that begins when constructed and ends when it goes out of scope
+	class Scope {
+	public:
+		explicit Scope(const char *name) : name(name) { begin(name); }
+		~Scope() { end(name); }
+	private:
+		Scope(const Scope&);
+		Scope &operator=(const Scope&);
+		const char *name;
+	};
+
+	//marks everything until it goes out of scope as one game frame, so onFrame's early returns
+	//still close the frame
+	class FrameScope {
+	public:
+		explicit FrameScope(int frame) { beginFrame(frame); }
+		~FrameScope() { endFrame(); }
+	private:
+		FrameScope(const FrameScope&);
+		FrameScope &operator=(const FrameScope&);
+	};
+
+}
\ No newline at end of file
@@ -1,5 +1,12 @@
+#include <climits>
+#include <map>
+
 #include "UnitBehavior.h"
 #include "MilitaryManager.h"
+#include "CommandDispatcher.h"
+#include "EventScheduler.h"
+#include "Trace.h"
+#include "PathFinder.h"
 
 using namespace BWAPI;
 using namespace Filter;
@@ -16,6 +23,11 @@ namespace UnitBehavior {
 	bool exploredAllStartLocs = false;
 	bool foundOpponent = false;
 
+	//walking distance from our base to each start location, keyed by y * 256 + x; filled in as
+	//PathFinder answers, and missing for ones we can't walk to
+	static std::map<int, int> startLocDistances;
+	static bool requestedStartLocDistances = false;
+
 	//used to ensure that we don't have multiple workers trying to queue the same goal or depot
 	static int lastFrameOnWhichStructureEnqueued = 0;
 
@@ -200,8 +212,8 @@ namespace UnitBehavior {
 								//if we don't have an addon
 								if (!u->getAddon() && canAfford(g.structureType)) {
 									if (u->isTraining())
-										u->cancelTrain();
-									if (u->buildAddon(g.structureType)) {
+										CommandDispatcher::issue(u, UnitCommand::cancelTrain(u));
+									if (CommandDispatcher::issue(u, UnitCommand::buildAddon(u, g.structureType))) {
 										g.assignee = u;
 										g.gracePeriod = Broodwar->getFrameCount() + Broodwar->getLatencyFrames() + 48;
 										goalsUnderConstruction.push_back(g);
@@ -241,9 +253,22 @@ namespace UnitBehavior {
 					scout = worker; //congrats, you're our new scout!
 			}
 			else if (scout == worker) { //if we ARE the scout, then move to unexplored start locations
+				//find out how far each start location is on foot, without holding up this frame
+				if (!requestedStartLocDistances) {
+					requestedStartLocDistances = true;
+					for (auto &startLoc : Broodwar->getStartLocations()) {
+						int key = startLoc.y * 256 + startLoc.x;
+						PathFinder::requestPath(Position(Broodwar->self()->getStartLocation()), Position(startLoc), [key](const PathFinder::Path &path) {
+							if (path.found)
+								startLocDistances[key] = path.length;
+						});
+					}
+				}
 				bool isMovingToUnexploredStartLoc = false;
 				bool unexploredStartLocExists = false;
 				Point<int, 1> unexploredStartLocCoords;
+				//the closest on foot goes first; until the paths come back, the last one listed
+				int closestStartLocDistance = INT_MAX;
 				for (auto &startLoc : Broodwar->getStartLocations()) {
 					if (!Broodwar->isExplored(startLoc)) {
 						unexploredStartLocExists = true;
@@ -252,15 +277,21 @@ namespace UnitBehavior {
 						startLocCoords.y = startLoc.y * TILE_SIZE;
 						if (worker->getOrderTargetPosition().getDistance(startLocCoords) < 8 * TILE_SIZE)
 							isMovingToUnexploredStartLoc = true;
-						else
-							unexploredStartLocCoords = startLocCoords;
+						else {
+							auto known = startLocDistances.find(startLoc.y * 256 + startLoc.x);
+							int distance = known != startLocDistances.end() ? known->second : INT_MAX;
+							if (distance <= closestStartLocDistance) {
+								closestStartLocDistance = distance;
+								unexploredStartLocCoords = startLocCoords;
+							}
+						}
 					}
 				}
 
 				if (!unexploredStartLocExists) { //no unexplored start location exists
 					exploredAllStartLocs = true;
 					//scout's job is done, send him home
-					scout->move(scout->getClosestUnit(Filter::IsOwned && Filter::IsResourceDepot)->getPosition());
+					CommandDispatcher::issue(scout, UnitCommand::move(scout, TRACE_CALL("getClosestUnit", scout->getClosestUnit(Filter::IsOwned && Filter::IsResourceDepot))->getPosition()));
 					scout = nullptr;
 				}
 
@@ -273,7 +304,7 @@ namespace UnitBehavior {
 				if (foundOpponent) {
 					if (scout) {
 						//found opponent, go home
-						scout->move(scout->getClosestUnit(Filter::IsOwned && Filter::IsResourceDepot)->getPosition());
+						CommandDispatcher::issue(scout, UnitCommand::move(scout, TRACE_CALL("getClosestUnit", scout->getClosestUnit(Filter::IsOwned && Filter::IsResourceDepot))->getPosition()));
 						scout = nullptr;
 					}
 					//let's see what we found
@@ -281,7 +312,7 @@ namespace UnitBehavior {
 				}
 				else
 					if (!isMovingToUnexploredStartLoc)
-						scout->move(unexploredStartLocCoords);
+						CommandDispatcher::issue(scout, UnitCommand::move(scout, unexploredStartLocCoords));
 			} //this unit are the scout
 		} //there is still a reason to scout
 
@@ -386,7 +417,7 @@ namespace UnitBehavior {
 				continue;
 			}
 			else if (resolution == 1) { //construction stopped; assign new SCV to finish construction
-				worker->rightClick(g.structure);
+				CommandDispatcher::issue(worker, UnitCommand::rightClick(worker, g.structure));
 				g.assignee = worker;
 				i++;
 				continue;
@@ -435,13 +466,13 @@ namespace UnitBehavior {
 			if (worker->isCarryingGas() || worker->isCarryingMinerals())
 			{
 				//if so, return those resources
-				worker->returnCargo();
+				CommandDispatcher::issue(worker, UnitCommand::returnCargo(worker));
 			}
 
 			//if we're not carrying a powerup (which would prevent us harvesting resources)
 			else if (!worker->getPowerUp()) {
 				//start harvesting from the nearest mineral patch
-				if (worker->gather((worker->getClosestUnit(Filter::IsMineralField))))
+				if (CommandDispatcher::issue(worker, UnitCommand::gather(worker, TRACE_CALL("getClosestUnit", worker->getClosestUnit(Filter::IsMineralField)))))
 					return true;
 			} //if has no powerup
 		} // if idle
@@ -520,6 +551,32 @@ namespace UnitBehavior {
 		return true;
 	}
 
+	///<summary>Creates an unassigned goal for the specified structure without adding it
+	///to the goal list.</summary>
+	Goal makeGoal(BWAPI::UnitType structure) {
+		Goal newGoal;
+		newGoal.structureType = structure;
+		newGoal.structure = nullptr;
+		newGoal.assignee = nullptr;
+		newGoal.tech = TechTypes::None;
+		newGoal.isResearch = false;
+		newGoal.gracePeriod = 0;
+		return newGoal;
+	}
+
+	///<summary>Creates an unassigned goal for the specified tech without adding it
+	///to the goal list.</summary>
+	Goal makeGoal(BWAPI::TechType tech) {
+		Goal newGoal;
+		newGoal.structureType = UnitTypes::None;
+		newGoal.structure = nullptr;
+		newGoal.assignee = nullptr;
+		newGoal.tech = tech;
+		newGoal.isResearch = true;
+		newGoal.gracePeriod = 0;
+		return newGoal;
+	}
+
 	///<summary>Trains a worker from the target townhall if possible and desirable.</summary>
 	bool evaluateTownhallLogicFor(BWAPI::Unit townhall, int workerCount) {
 		if (!townhall->getType().isResourceDepot()) {
@@ -533,8 +590,8 @@ namespace UnitBehavior {
 			workerCount > WORKERS_REQUIRED_BEFORE_MINING_GAS &&
 			canAfford(UnitTypes::Terran_Refinery)) {
 			gracePeriod = Broodwar->getFrameCount() + 120;
-			Unit closestGeyser = townhall->getClosestUnit(Filter::GetType == UnitTypes::Resource_Vespene_Geyser);
-			Unit closestRefinery = townhall->getClosestUnit(Filter::IsRefinery);
+			Unit closestGeyser = TRACE_CALL("getClosestUnit", townhall->getClosestUnit(Filter::GetType == UnitTypes::Resource_Vespene_Geyser));
+			Unit closestRefinery = TRACE_CALL("getClosestUnit", townhall->getClosestUnit(Filter::IsRefinery));
 
 			if (closestGeyser) { //if a geyser exists
 				//if the closest geyser is closer than the closest refinery (or no refinery exists), 
@@ -543,7 +600,7 @@ namespace UnitBehavior {
 					//pick a worker and issue the build order
 					for (auto &worker : Broodwar->self()->getUnits()) {
 						if (worker->exists() && worker->getType().isWorker() && !Helpers::unitIsDisabled(worker) && worker->isGatheringMinerals()) {
-							worker->build(UnitTypes::Terran_Refinery, closestGeyser->getTilePosition());
+							CommandDispatcher::issue(worker, UnitCommand::build(worker, closestGeyser->getTilePosition(), UnitTypes::Terran_Refinery));
 							break;
 						} //unit is worker and is not disabled
 					} //unit iterator
@@ -556,10 +613,10 @@ namespace UnitBehavior {
 		static int counter = 0;
 		if (counter >= 100) {
 			counter -= 100;
-			Unitset nearbyEnemies = townhall->getUnitsInRadius(32 * TILE_SIZE, Filter::IsEnemy);
+			Unitset nearbyEnemies = TRACE_CALL("getUnitsInRadius", townhall->getUnitsInRadius(32 * TILE_SIZE, Filter::IsEnemy));
 			if (nearbyEnemies.size() > 0) {
-				for (auto &worker : townhall->getUnitsInRadius(16 * TILE_SIZE, Filter::IsOwned && Filter::IsWorker)) {
-					worker->attack(nearbyEnemies.getPosition());
+				for (auto &worker : TRACE_CALL("getUnitsInRadius", townhall->getUnitsInRadius(16 * TILE_SIZE, Filter::IsOwned && Filter::IsWorker))) {
+					CommandDispatcher::issue(worker, UnitCommand::attack(worker, nearbyEnemies.getPosition()));
 				}
 			}
 		}
@@ -615,13 +672,13 @@ namespace UnitBehavior {
 		}
 
 		//get workers in a radius around this refinery
-		for (auto &worker : refinery->getUnitsInRadius(TILE_SIZE * 64, Filter::IsWorker)) {
+		for (auto &worker : TRACE_CALL("getUnitsInRadius", refinery->getUnitsInRadius(TILE_SIZE * 64, Filter::IsWorker))) {
 
 			//a worker is already mining from this refinery
 			if (worker->isGatheringGas() && worker->getOrderTarget() == refinery) {
 				//if it isn't on our list of workers
 				if (std::find(std::begin(ref.workers), std::end(ref.workers), worker) == std::end(ref.workers))
-					worker->stop(); //then stop doing that
+					CommandDispatcher::issue(worker, UnitCommand::stop(worker)); //then stop doing that
 			}
 
 			//if we have less than three workers mining here
@@ -630,7 +687,7 @@ namespace UnitBehavior {
 				if (workerIsAvailable(worker) && workerCount > WORKERS_REQUIRED_BEFORE_MINING_GAS)
 				{
 					//order the worker to harvest gas
-					worker->gather(refinery);
+					CommandDispatcher::issue(worker, UnitCommand::gather(worker, refinery));
 					//add the worker to the list of workers mining from this refinery
 					ref.workers.push_front(worker);
 				} //worker is able to mine gas and we have enough workers to justify doing so
@@ -709,43 +766,11 @@ namespace UnitBehavior {
 		/* Units in combat should attempt to use stim - for units that don't
 		have this ability, this call will fail with no side effects */
 		if (unit->isAttacking() && unit->getStimTimer() <= 0)
-			unit->useTech(TechTypes::Stim_Packs);
-
-		if (unit->getType() == UnitTypes::Terran_Siege_Tank_Siege_Mode ||
-			unit->getType() == UnitTypes::Terran_Siege_Tank_Tank_Mode) {
-
-			Unitset nearbyEnemies = unit->getUnitsInRadius(TILE_SIZE * 8, Filter::IsEnemy && !Filter::IsFlyer);
-			int closestEnemyDistance = nearbyEnemies.size() > 0 ? (int)nearbyEnemies.getPosition().getDistance(unit->getPosition()) : 99999;
-			int siegeModeMaxRange = UnitTypes::Terran_Siege_Tank_Siege_Mode.groundWeapon().maxRange();
-			int siegeModeMinRange = UnitTypes::Terran_Siege_Tank_Siege_Mode.groundWeapon().minRange();
-
-			if (unit->getType() == UnitTypes::Terran_Siege_Tank_Tank_Mode &&
-				closestEnemyDistance <= siegeModeMaxRange &&
-				closestEnemyDistance > siegeModeMinRange
-				) {
-				//enter siege mode if the enemy is within max range while sieged but outside min range while sieged
-				unit->siege();
-			}
+			CommandDispatcher::issue(unit, UnitCommand::useTech(unit, TechTypes::Stim_Packs));
 
-			if (unit->getType() == UnitTypes::Terran_Siege_Tank_Siege_Mode &&
-				(closestEnemyDistance > siegeModeMaxRange ||
-				closestEnemyDistance <= siegeModeMinRange)) {
-				//exit siege mode if there are no enemies within range or the closest enemy is within our minimum range
-				unit->unsiege();
-			}
-		}
+		//siege tanks are left to TankController, which decides every tank's mode together
 
-		static int scanGracePeriod = 0;
-		if (Broodwar->getFrameCount() > scanGracePeriod) {
-			if (unit->getType() == UnitTypes::Terran_Comsat_Station) {
-				for (auto &u : Broodwar->enemy()->getUnits()) {
-					if ((u->isCloaked() || u->isBurrowed()) && !u->isDetected()) {
-						unit->useTech(TechTypes::Scanner_Sweep, u->getPosition());
-						scanGracePeriod = Broodwar->getFrameCount() + 120;
-					} //undetected cloaked unit
-				} //enemy unit iterator
-			} //unit is comsat station
-		} //grace period elapsed
+		//comsats are left to ScanPlanner, which plans every comsat's scans together
 
 		return true;
 	}
@@ -765,22 +790,21 @@ namespace UnitBehavior {
 		if (!structure.isBuilding() || structure.getRace() != Broodwar->self()->getRace())
 			return false;
 		if (canAfford(structure)) {
-			TilePosition targetBuildLocation = placer.getBuildLocationNear(worker->getTilePosition(), structure);
+			TilePosition targetBuildLocation = placer.getBuildLocationNear(worker, structure);
 			if (!targetBuildLocation) {
 				targetBuildLocation = placer.getBuildLocation(structure);
 			}
 			if (targetBuildLocation) {
-				if (worker->build(structure, targetBuildLocation)) {
+				if (CommandDispatcher::issue(worker, UnitCommand::build(worker, targetBuildLocation, structure))) {
 					lastFrameOnWhichStructureEnqueued = Broodwar->getFrameCount();
 
 					//register an event that draws the target build location for a few seconds
-					Broodwar->registerEvent([targetBuildLocation, structure](Game*)
+					EventScheduler::schedule([targetBuildLocation, structure]()
 					{
 						Broodwar->drawBoxMap(Position(targetBuildLocation),
 							Position(targetBuildLocation + structure.tileSize()),
 							Colors::Blue);
 					},
-						nullptr,								//condition
 						100);	//duration in frames
 					return true;
 				}
@@ -788,10 +812,9 @@ namespace UnitBehavior {
 					//if the order fails, draw a message over the worker with the reason
 					Position pos = worker->getPosition();
 					Error lastErr = Broodwar->getLastError();
-					Broodwar->registerEvent([pos, lastErr](Game*){
+					EventScheduler::schedule([pos, lastErr](){
 						Broodwar->drawTextMap(pos, "%c%s%s", Text::White, "Failed to build structure: ", lastErr.c_str());
 					},
-						nullptr,						//condition
 						Broodwar->getLatencyFrames());	//duration in frames
 				}
 			} //placement valid
@@ -803,7 +826,7 @@ namespace UnitBehavior {
 		if (!structure->getType().isBuilding())
 			return false;
 		if (canAfford(type)) {
-			if (structure->train(type))
+			if (CommandDispatcher::issue(structure, UnitCommand::train(structure, type)))
 				return true;
 			else {
 				/* For debugging purposes, if we're unable to train a unit for whatever reason, register an event
@@ -814,8 +837,7 @@ namespace UnitBehavior {
 				pos.y = structure->getTop() - 25;
 
 				Error lastErr = Broodwar->getLastError();
-				Broodwar->registerEvent([pos, lastErr](Game*){ Broodwar->drawTextMap(pos, "%c%s%s", Text::White, "Cannot train: ", lastErr.c_str()); },   // action
-					nullptr,    // condition
+				EventScheduler::schedule([pos, lastErr](){ Broodwar->drawTextMap(pos, "%c%s%s", Text::White, "Cannot train: ", lastErr.c_str()); },   // action
 					Broodwar->getLatencyFrames());  // frames to run
 				return false;
 			}
@@ -827,7 +849,7 @@ namespace UnitBehavior {
 		if (!structure->getType().isBuilding())
 			return false;
 		if (canAfford(type))
-			if (structure->research(type))
+			if (CommandDispatcher::issue(structure, UnitCommand::research(structure, type)))
 				return true;
 
 		return false;
@@ -41,6 +41,8 @@ namespace UnitBehavior {
 	extern bool addGoal(BWAPI::UnitType structure, bool front = false, int count = 1);
 	extern bool addGoal(Goal &goal, bool front = false, int count = 1);
 	extern bool addGoal(BWAPI::TechType tech, bool front = false, int count = 1);
+	extern Goal makeGoal(BWAPI::UnitType structure);
+	extern Goal makeGoal(BWAPI::TechType tech);
 	extern std::deque<Goal> getGoals();
 
 }
\ No newline at end of file
@@ -0,0 +1,44 @@
+@echo off
+setlocal
+rem Records or checks a frame-time regression run; see TerranAIModule/Source/Regression.h.
+rem Run from the StarCraft folder, before and after playing the corpus:
+rem   regression_check record  clears the previous results and makes the next run record
+rem                            each scenario into the baseline instead of checking it
+rem   regression_check clean   clears the previous results before a checked run
+rem   regression_check         reports the run; exits with 1 if any scenario failed, had no
+rem                            baseline or lost one it used to reach, or if nothing was played
+set results=bwapi-data\write\regression_results.txt
+set failed=bwapi-data\write\regression_failed.txt
+set record=bwapi-data\write\regression_record.txt
+set baseline=bwapi-data\read\regression_baseline.txt
+if "%~1"=="clean" (
+  del /q "%results%" "%failed%" "%record%" 2>nul
+  exit /b 0
+)
+if "%~1"=="record" (
+  del /q "%results%" "%failed%" 2>nul
+  echo recording> "%record%"
+  echo Play the corpus, then run regression_check to finish recording.
+  exit /b 0
+)
+if not exist "%results%" (
+  echo No regression results; was the corpus played?
+  exit /b 1
+)
+type "%results%"
+if exist "%record%" (
+  del /q "%record%"
+  echo Baseline recorded in %baseline%; commit it.
+  exit /b 0
+)
+findstr /r /v /c:"^#" /c:"^$" "%baseline%" >nul
+if errorlevel 1 (
+  echo %baseline% has no scenarios; run "regression_check record" and play the corpus first.
+  exit /b 1
+)
+if exist "%failed%" (
+  echo Regressed:
+  type "%failed%"
+  exit /b 1
+)
+exit /b 0
@@ -12,6 +12,7 @@
 #include <BWAPI/Client/PlayerImpl.h>
 #include <BWAPI/Client/Shape.h>
 #include <BWAPI/Client/ShapeType.h>
+#include <BWAPI/Client/Transport.h>
 #include <BWAPI/Client/UnitCommand.h>
 #include <BWAPI/Client/UnitData.h>
 #include <BWAPI/Client/UnitImpl.h>
@@ -5,9 +5,9 @@
 #include "PlayerImpl.h"
 #include "UnitImpl.h"
 #include "GameTable.h"
+#include "Transport.h"
 
-#include "../WindowsTypes.h"
-
+#include <memory>
 
 namespace BWAPI
 {
@@ -22,12 +22,13 @@ namespace BWAPI
     void disconnect();
     void update();
 
+    /// Replaces the transport used to reach the server; takes ownership. Only takes effect
+    /// while disconnected.
+    void setTransport(Transport* transport);
+
     GameData* data = nullptr;
   private:
-    HANDLE      pipeObjectHandle;
-    HANDLE      mapFileHandle;
-    HANDLE      gameTableFileHandle;
-    GameTable*  gameTable = nullptr;
+    std::unique_ptr<Transport> transport;
     
     bool connected = false;
   };
@@ -14,6 +14,7 @@
 
 #include <list>
 #include <vector>
+#include <deque>
 #include <array>
 
 namespace BWAPI
@@ -27,16 +28,27 @@ namespace BWAPI
   {
     private :
       int addShape(const BWAPIC::Shape &s);
-      int addString(const char* text);
+      int addString(const char* text, int headroom = 0);
       int addText(BWAPIC::Shape &s, const char* text);
+      bool hasShapeRoom(const BWAPIC::Shape &s) const;
       int addCommand(const BWAPIC::Command &c);
+      int addStringCommand(BWAPIC::CommandType::Enum type, const char* text, int value2 = 0);
       void processInterfaceEvents();
       void clearAll();
+      void updateUnitRelations(UnitImpl *u);
+      void unlinkUnitRelations(UnitImpl *u);
+      void updatePlayerSets();
+      UnitImpl* getUnitImpl(int unitId) const;
+      Event& nextEvent(const BWAPIC::Event &e);
+      void fillEvent(Event &e2, const BWAPIC::Event &e);
 
       GameData* data;
       std::vector<ForceImpl>  forceVector;
       std::vector<PlayerImpl> playerVector;
-      std::vector<UnitImpl>   unitVector;
+      // units are only constructed once something asks for them, and live as long as the GameImpl;
+      // the deque keeps their addresses stable
+      mutable std::deque<UnitImpl>   unitPool;
+      mutable std::vector<UnitImpl*> unitTable;  // unit id -> unit, or null if not yet constructed
       std::vector<BulletImpl> bulletVector;
       std::array<RegionImpl*,5000> regionArray;
 
@@ -58,12 +70,20 @@ namespace BWAPI
 
       TilePosition::list startLocations;
       std::list< Event > events;
+      // list nodes from earlier frames, kept so building the event list doesn't allocate;
+      // nodes that held text keep their string buffers for the next text event
+      std::list< Event > spareEvents;
+      std::list< Event > spareTextEvents;
       Player thePlayer;
       Player theEnemy;
       Player theNeutral;
       Playerset _allies;
       Playerset _enemies;
       Playerset _observers;
+      std::array<bool,100> bulletExists;  // which bullet slots are in the bullets set
+      std::vector<int> lastSelection;     // selected unit ids the selectedUnits set was built from
+      unsigned long long playerSetKey;    // player flags the allies/enemies/observers sets were built from
+      std::array<int,4096> internedStrings; // text hash -> string slot that last held that text, or -1
       mutable Error lastError;
       Text::Size::Enum textSize;
 
@@ -0,0 +1,82 @@
+#pragma once
+#include "GameData.h"
+#include "GameTable.h"
+
+#ifdef _WIN32
+#include "../WindowsTypes.h"
+#endif
+
+namespace BWAPI
+{
+  /// How the client reaches the server's GameData block and hands control of it back and forth
+  /// each frame. One side works on the frame while the other waits, then signals and waits in turn.
+  class Transport
+  {
+  public:
+    virtual ~Transport() {}
+
+    /// Finds the server and maps its game data. Returns false if there is no server to attach to.
+    virtual bool open() = 0;
+    virtual void close() = 0;
+    virtual GameData* getData() const = 0;
+
+    /// Hands the current frame to the other side.
+    virtual bool signal() = 0;
+    /// Blocks until the other side hands the frame back. Returns false if it went away.
+    virtual bool wait() = 0;
+  };
+
+#ifdef _WIN32
+  /// The stock transport: the game table and game data in Win32 file mappings, with int codes
+  /// exchanged over a named pipe.
+  class PipeTransport : public Transport
+  {
+  public:
+    PipeTransport();
+    virtual ~PipeTransport();
+
+    virtual bool open() override;
+    virtual void close() override;
+    virtual GameData* getData() const override;
+    virtual bool signal() override;
+    virtual bool wait() override;
+  private:
+    HANDLE      pipeObjectHandle;
+    HANDLE      mapFileHandle;
+    HANDLE      gameTableFileHandle;
+    GameTable*  gameTable = nullptr;
+    GameData*   data = nullptr;
+  };
+#endif
+
+#ifdef __linux__
+  /// Game data in a POSIX shared memory object, preceded by a pair of futex words that each side
+  /// bumps to hand over the frame. Used by stand-in servers for headless testing. Both the client
+  /// and the stand-in server use this class; the server creates the object, the client attaches.
+  class SharedMemoryTransport : public Transport
+  {
+  public:
+    enum Role { ClientRole, ServerRole };
+
+    /// A serverProcID of zero means the client reads it from BWAPI_SERVER_PID when opening.
+    SharedMemoryTransport(int serverProcID = 0, Role role = ClientRole);
+    virtual ~SharedMemoryTransport();
+
+    virtual bool open() override;
+    virtual void close() override;
+    virtual GameData* getData() const override;
+    virtual bool signal() override;
+    virtual bool wait() override;
+  private:
+    struct Handshake;
+
+    int        serverProcID;
+    Role       role;
+    int        fileDescriptor = -1;
+    void*      mapping = nullptr;
+    Handshake* handshake = nullptr;
+    GameData*  data = nullptr;
+    int        lastSeen = 0;
+  };
+#endif
+}
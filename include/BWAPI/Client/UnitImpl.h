@@ -8,6 +8,27 @@ namespace BWAPI
   class PlayerInterface;
   typedef PlayerInterface *Player;
 
+  /// A unit set that takes no memory until something is put in it. Sets are drawn from a pool
+  /// shared by every unit and returned to it, buckets intact, when cleared; most units never
+  /// carry, hatch or launch anything, so most of these never allocate.
+  class PooledUnitset
+  {
+    public:
+      PooledUnitset();
+      ~PooledUnitset();
+
+      void   insert(Unit unit);
+      void   erase(Unit unit);
+      void   clear();
+      size_t size() const;
+      operator const Unitset&() const;
+    private:
+      PooledUnitset(const PooledUnitset&);
+      PooledUnitset& operator=(const PooledUnitset&);
+
+      Unitset* set;
+  };
+
   class UnitImpl : public UnitInterface
   {
     private:
@@ -20,8 +41,10 @@ namespace BWAPI
       UnitCommand lastCommand;
     public:
       UnitData* self;
-      Unitset   connectedUnits;
-      Unitset   loadedUnits;
+      PooledUnitset connectedUnits;
+      PooledUnitset loadedUnits;
+      int       connectedToID;  // hatchery or carrier whose connectedUnits contains this unit, or -1
+      int       loadedIntoID;   // transport whose loadedUnits contains this unit, or -1
       void      clear();
       void      saveInitialState();
 
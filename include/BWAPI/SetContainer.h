@@ -25,6 +25,19 @@ namespace BWAPI
     
     template <class IterT>
     SetContainer(IterT _begin, IterT _end) : SetContainerUnderlyingT<T, HashT>(_begin, _end) {}
+
+    // Declaring the move constructor deletes the implicit assignment operators, so they are
+    // spelled out; Visual C++ 2013 generates them anyway, but other compilers don't.
+    SetContainer &operator =(SetContainer const &other)
+    {
+      SetContainerUnderlyingT<T, HashT>::operator =(other);
+      return *this;
+    }
+    SetContainer &operator =(SetContainer &&other)
+    {
+      SetContainerUnderlyingT<T, HashT>::operator =(std::move(other));
+      return *this;
+    }
     
     /// <summary>Iterates the set and erases each element x where pred(x) returns true.</summary>
     ///
@@ -48,7 +61,7 @@ namespace BWAPI
     /// </param>
     bool contains(T const &value) const
     {
-      return count(value) != 0;
+      return this->count(value) != 0;
     }
   };
 
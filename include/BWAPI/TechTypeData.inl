@@ -0,0 +1,53 @@
+// Numeric properties of every tech type, one row per tech id including the unused ids.
+// This is the single source of these values: TechTypeTraits (TypeTraits.h) and the
+// TechType tables (TechType.cpp) are both expanded from it. The gas price of a tech is
+// always the same as its mineral price.
+//
+// BWAPI_TECH_TYPE(id, mineralPrice, researchTime, energyCost)
+BWAPI_TECH_TYPE(0, 100, 1200, 0) // Stim_Packs
+BWAPI_TECH_TYPE(1, 200, 1500, 100) // Lockdown
+BWAPI_TECH_TYPE(2, 200, 1800, 100) // EMP_Shockwave
+BWAPI_TECH_TYPE(3, 100, 1200, 0) // Spider_Mines
+BWAPI_TECH_TYPE(4, 0, 0, 50) // Scanner_Sweep
+BWAPI_TECH_TYPE(5, 150, 1200, 0) // Tank_Siege_Mode
+BWAPI_TECH_TYPE(6, 0, 0, 100) // Defensive_Matrix
+BWAPI_TECH_TYPE(7, 200, 1200, 75) // Irradiate
+BWAPI_TECH_TYPE(8, 100, 1800, 150) // Yamato_Gun
+BWAPI_TECH_TYPE(9, 150, 1500, 25) // Cloaking_Field
+BWAPI_TECH_TYPE(10, 100, 1200, 25) // Personnel_Cloaking
+BWAPI_TECH_TYPE(11, 100, 1200, 0) // Burrowing
+BWAPI_TECH_TYPE(12, 0, 0, 0) // Infestation
+BWAPI_TECH_TYPE(13, 100, 1200, 150) // Spawn_Broodlings
+BWAPI_TECH_TYPE(14, 0, 0, 100) // Dark_Swarm
+BWAPI_TECH_TYPE(15, 200, 1500, 150) // Plague
+BWAPI_TECH_TYPE(16, 100, 1500, 0) // Consume
+BWAPI_TECH_TYPE(17, 100, 1200, 75) // Ensnare
+BWAPI_TECH_TYPE(18, 0, 0, 75) // Parasite
+BWAPI_TECH_TYPE(19, 200, 1800, 75) // Psionic_Storm
+BWAPI_TECH_TYPE(20, 150, 1200, 100) // Hallucination
+BWAPI_TECH_TYPE(21, 150, 1800, 150) // Recall
+BWAPI_TECH_TYPE(22, 150, 1500, 100) // Stasis_Field
+BWAPI_TECH_TYPE(23, 0, 0, 0) // Archon_Warp
+BWAPI_TECH_TYPE(24, 100, 1200, 50) // Restoration
+BWAPI_TECH_TYPE(25, 200, 1200, 125) // Disruption_Web
+BWAPI_TECH_TYPE(26, 0, 0, 0)
+BWAPI_TECH_TYPE(27, 200, 1800, 150) // Mind_Control
+BWAPI_TECH_TYPE(28, 0, 0, 0) // Dark_Archon_Meld
+BWAPI_TECH_TYPE(29, 100, 1800, 50) // Feedback
+BWAPI_TECH_TYPE(30, 100, 1800, 75) // Optical_Flare
+BWAPI_TECH_TYPE(31, 100, 1500, 100) // Maelstrom
+BWAPI_TECH_TYPE(32, 200, 1800, 0) // Lurker_Aspect
+BWAPI_TECH_TYPE(33, 0, 0, 0)
+BWAPI_TECH_TYPE(34, 0, 0, 1) // Healing
+BWAPI_TECH_TYPE(35, 0, 0, 0)
+BWAPI_TECH_TYPE(36, 0, 0, 0)
+BWAPI_TECH_TYPE(37, 0, 0, 0)
+BWAPI_TECH_TYPE(38, 0, 0, 0)
+BWAPI_TECH_TYPE(39, 0, 0, 0)
+BWAPI_TECH_TYPE(40, 0, 0, 0)
+BWAPI_TECH_TYPE(41, 0, 0, 0)
+BWAPI_TECH_TYPE(42, 0, 0, 0)
+BWAPI_TECH_TYPE(43, 0, 0, 0)
+BWAPI_TECH_TYPE(44, 0, 0, 0) // None
+BWAPI_TECH_TYPE(45, 0, 0, 0) // Nuclear_Strike
+BWAPI_TECH_TYPE(46, 0, 0, 0) // Unknown
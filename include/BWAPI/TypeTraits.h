@@ -0,0 +1,121 @@
+#pragma once
+#include <BWAPI/TechType.h>
+#include <BWAPI/UnitType.h>
+#include <BWAPI/UpgradeType.h>
+#include <BWAPI/WeaponType.h>
+
+namespace BWAPI
+{
+  /// <summary>The numeric properties of a weapon type as compile-time constants.</summary>
+  /// Each member has the same value as the WeaponType accessor of the same name, but is an
+  /// integral constant expression, so it can be used in static_assert, array bounds and
+  /// template arguments.
+  ///
+  /// @see UnitTypeTraits
+  template <int WeaponTypeId>
+  struct WeaponTypeTraits;
+
+  /// <summary>The numeric properties of a unit type as compile-time constants.</summary>
+  /// Each member has the same value as the UnitType accessor of the same name. The unit's
+  /// weapons are available as GroundWeapon and AirWeapon, so weapon properties can be checked
+  /// through the unit that carries them.
+  ///
+  /// @code
+  ///   typedef UnitTypeTraits<UnitTypes::Enum::Terran_Siege_Tank_Siege_Mode> SiegeTank;
+  ///   static_assert(SiegeTank::GroundWeapon::maxRange == 12 * 32, "siege range changed");
+  ///
+  ///   Unit passengers[UnitTypeTraits<UnitTypes::Enum::Terran_Bunker>::spaceProvided];
+  /// @endcode
+  template <int UnitTypeId>
+  struct UnitTypeTraits;
+
+  /// <summary>The costs of a tech type as compile-time constants.</summary>
+  /// Each member has the same value as the TechType accessor of the same name.
+  ///
+  /// @see UpgradeTypeTraits
+  template <int TechTypeId>
+  struct TechTypeTraits;
+
+  /// <summary>The costs of an upgrade type as compile-time constants.</summary>
+  /// mineralPrice, gasPrice and upgradeTime are the first-level values, i.e. what the
+  /// UpgradeType accessors return for level 1; use the level template for later levels.
+  ///
+  /// @code
+  ///   typedef UpgradeTypeTraits<UpgradeTypes::Enum::Terran_Vehicle_Weapons> VehicleWeapons;
+  ///   static_assert(VehicleWeapons::level<2>::mineralPrice == 175, "upgrade cost changed");
+  /// @endcode
+  template <int UpgradeTypeId>
+  struct UpgradeTypeTraits;
+
+#define BWAPI_WEAPON_TYPE(id, damage, bonus, cooldown, factor, minRng, maxRng, inner, median, outer) \
+  template <> struct WeaponTypeTraits<id>                                                 \
+  {                                                                                       \
+    enum                                                                                  \
+    {                                                                                     \
+      damageAmount = damage, damageBonus = bonus, damageCooldown = cooldown,              \
+      damageFactor = factor, minRange = minRng, maxRange = maxRng,                        \
+      innerSplashRadius = inner, medianSplashRadius = median, outerSplashRadius = outer   \
+    };                                                                                    \
+  };
+#include <BWAPI/WeaponTypeData.inl>
+#undef BWAPI_WEAPON_TYPE
+
+#define BWAPI_UNIT_TYPE(name, hp, sp, arm, ore, gas, time, supReq, supProv, spaceReq, spaceProv, tileW, tileH, \
+                        left, up, right, down, seek, sight, ground, groundHits, air, airHits) \
+  template <> struct UnitTypeTraits<UnitTypes::Enum::name>                                \
+  {                                                                                       \
+    enum                                                                                  \
+    {                                                                                     \
+      maxHitPoints = hp, maxShields = sp, armor = arm,                                    \
+      mineralPrice = ore, gasPrice = gas, buildTime = time,                               \
+      supplyRequired = supReq, supplyProvided = supProv,                                  \
+      spaceRequired = spaceReq, spaceProvided = spaceProv,                                \
+      tileWidth = tileW, tileHeight = tileH,                                              \
+      dimensionLeft = left, dimensionUp = up, dimensionRight = right, dimensionDown = down, \
+      width = left + 1 + right, height = up + 1 + down,                                   \
+      seekRangeTiles = seek, sightRangeTiles = sight,                                     \
+      seekRange = seek * 32, sightRange = sight * 32,                                     \
+      groundWeapon = WeaponTypes::Enum::ground, maxGroundHits = groundHits,               \
+      airWeapon = WeaponTypes::Enum::air, maxAirHits = airHits                            \
+    };                                                                                    \
+    typedef WeaponTypeTraits<WeaponTypes::Enum::ground> GroundWeapon;                     \
+    typedef WeaponTypeTraits<WeaponTypes::Enum::air> AirWeapon;                           \
+  };
+#include <BWAPI/UnitTypeData.inl>
+#undef BWAPI_UNIT_TYPE
+
+#define BWAPI_TECH_TYPE(id, ore, time, energy)                                            \
+  template <> struct TechTypeTraits<id>                                                   \
+  {                                                                                       \
+    enum                                                                                  \
+    {                                                                                     \
+      mineralPrice = ore, gasPrice = ore, researchTime = time, energyCost = energy        \
+    };                                                                                    \
+  };
+#include <BWAPI/TechTypeData.inl>
+#undef BWAPI_TECH_TYPE
+
+#define BWAPI_UPGRADE_TYPE(id, ore, oreFactor, time, timeFactor, repeats)                 \
+  template <> struct UpgradeTypeTraits<id>                                                \
+  {                                                                                       \
+    enum                                                                                  \
+    {                                                                                     \
+      mineralPrice = ore, mineralPriceFactor = oreFactor,                                 \
+      gasPrice = ore, gasPriceFactor = oreFactor,                                         \
+      upgradeTime = time, upgradeTimeFactor = timeFactor,                                 \
+      maxRepeats = repeats                                                                \
+    };                                                                                    \
+    template <int Level>                                                                  \
+    struct level                                                                          \
+    {                                                                                     \
+      enum                                                                                \
+      {                                                                                   \
+        mineralPrice = ore + (Level > 1 ? Level - 1 : 0) * oreFactor,                     \
+        gasPrice = mineralPrice,                                                          \
+        upgradeTime = time + (Level > 1 ? Level - 1 : 0) * timeFactor                     \
+      };                                                                                  \
+    };                                                                                    \
+  };
+#include <BWAPI/UpgradeTypeData.inl>
+#undef BWAPI_UPGRADE_TYPE
+}
@@ -0,0 +1,242 @@
+// Numeric properties of every unit type, one row per type in UnitTypes::Enum order. This is
+// the single source of these values: UnitTypeTraits (TypeTraits.h) and UnitTypeTable
+// (UnitType.cpp) are both expanded from it, with BWAPI_UNIT_TYPE defined to suit.
+//
+// BWAPI_UNIT_TYPE(name, hitPoints, shields, armor, minerals, gas, buildTime,
+//                 supplyRequired, supplyProvided, spaceRequired, spaceProvided, tileWidth, tileHeight,
+//                 dimensionLeft, dimensionUp, dimensionRight, dimensionDown, seekRangeTiles, sightRangeTiles,
+//                 groundWeapon, maxGroundHits, airWeapon, maxAirHits)
+BWAPI_UNIT_TYPE(Terran_Marine, 40, 0, 0, 50, 0, 360, 2, 0, 1, 0, 1, 1, 8, 9, 8, 10, 0, 7, Gauss_Rifle, 1, Gauss_Rifle, 1)
+BWAPI_UNIT_TYPE(Terran_Ghost, 45, 0, 0, 25, 75, 750, 2, 0, 1, 0, 1, 1, 7, 10, 7, 11, 0, 9, C_10_Canister_Rifle, 1, C_10_Canister_Rifle, 1)
+BWAPI_UNIT_TYPE(Terran_Vulture, 80, 0, 0, 75, 0, 450, 4, 0, 2, 0, 1, 1, 16, 16, 15, 15, 0, 8, Fragmentation_Grenade, 1, None, 0)
+BWAPI_UNIT_TYPE(Terran_Goliath, 125, 0, 1, 100, 50, 600, 4, 0, 2, 0, 1, 1, 16, 16, 15, 15, 5, 8, Twin_Autocannons, 1, Hellfire_Missile_Pack, 1)
+BWAPI_UNIT_TYPE(Terran_Goliath_Turret, 0, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 1, 1, 1, 1, 0, 8, Twin_Autocannons, 1, Hellfire_Missile_Pack, 1)
+BWAPI_UNIT_TYPE(Terran_Siege_Tank_Tank_Mode, 150, 0, 1, 150, 100, 750, 4, 0, 4, 0, 1, 1, 16, 16, 15, 15, 8, 10, Arclite_Cannon, 1, None, 0)
+BWAPI_UNIT_TYPE(Terran_Siege_Tank_Tank_Mode_Turret, 0, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 1, 1, 1, 1, 8, 10, Arclite_Cannon, 1, None, 0)
+BWAPI_UNIT_TYPE(Terran_SCV, 60, 0, 0, 50, 0, 300, 2, 0, 1, 0, 1, 1, 11, 11, 11, 11, 1, 7, Fusion_Cutter, 1, None, 0)
+BWAPI_UNIT_TYPE(Terran_Wraith, 120, 0, 0, 150, 100, 900, 4, 0, 255, 0, 1, 1, 19, 15, 18, 14, 0, 7, Burst_Lasers, 1, Gemini_Missiles, 1)
+BWAPI_UNIT_TYPE(Terran_Science_Vessel, 200, 0, 1, 100, 225, 1200, 4, 0, 255, 0, 2, 2, 32, 33, 32, 16, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Hero_Gui_Montag, 160, 0, 3, 100, 50, 720, 0, 0, 1, 0, 1, 1, 11, 7, 11, 14, 3, 7, Flame_Thrower_Gui_Montag, 3, None, 0)
+BWAPI_UNIT_TYPE(Terran_Dropship, 150, 0, 1, 100, 100, 750, 4, 0, 255, 8, 2, 2, 24, 16, 24, 20, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Battlecruiser, 500, 0, 3, 400, 300, 2000, 12, 0, 255, 0, 2, 2, 37, 29, 37, 29, 0, 11, ATS_Laser_Battery, 1, ATA_Laser_Battery, 1)
+BWAPI_UNIT_TYPE(Terran_Vulture_Spider_Mine, 20, 0, 0, 1, 0, 1, 0, 0, 255, 0, 1, 1, 7, 7, 7, 7, 3, 3, Spider_Mines, 1, None, 0)
+BWAPI_UNIT_TYPE(Terran_Nuclear_Missile, 100, 0, 0, 200, 200, 1500, 16, 0, 255, 0, 1, 1, 7, 14, 7, 14, 0, 3, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Civilian, 40, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 1, 8, 9, 8, 10, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Hero_Sarah_Kerrigan, 250, 0, 3, 50, 150, 1500, 0, 0, 1, 0, 1, 1, 7, 10, 7, 11, 0, 11, C_10_Canister_Rifle_Sarah_Kerrigan, 1, C_10_Canister_Rifle_Sarah_Kerrigan, 1)
+BWAPI_UNIT_TYPE(Hero_Alan_Schezar, 300, 0, 3, 200, 100, 1200, 0, 0, 2, 0, 1, 1, 16, 16, 15, 15, 5, 8, Twin_Autocannons_Alan_Schezar, 1, Hellfire_Missile_Pack_Alan_Schezar, 1)
+BWAPI_UNIT_TYPE(Hero_Alan_Schezar_Turret, 0, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 1, 1, 1, 1, 0, 8, Twin_Autocannons_Alan_Schezar, 1, Hellfire_Missile_Pack_Alan_Schezar, 1)
+BWAPI_UNIT_TYPE(Hero_Jim_Raynor_Vulture, 300, 0, 3, 150, 0, 900, 0, 0, 2, 0, 1, 1, 16, 16, 15, 15, 0, 8, Fragmentation_Grenade_Jim_Raynor, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Jim_Raynor_Marine, 200, 0, 3, 50, 0, 1, 0, 0, 1, 0, 1, 1, 8, 9, 8, 10, 0, 7, Gauss_Rifle_Jim_Raynor, 1, Gauss_Rifle_Jim_Raynor, 1)
+BWAPI_UNIT_TYPE(Hero_Tom_Kazansky, 500, 0, 4, 400, 200, 1800, 0, 0, 255, 0, 1, 1, 19, 15, 18, 14, 0, 7, Burst_Lasers_Tom_Kazansky, 1, Gemini_Missiles_Tom_Kazansky, 1)
+BWAPI_UNIT_TYPE(Hero_Magellan, 800, 0, 4, 50, 600, 2400, 0, 0, 255, 0, 2, 2, 32, 33, 32, 16, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Hero_Edmund_Duke_Tank_Mode, 400, 0, 3, 300, 200, 1500, 0, 0, 4, 0, 1, 1, 16, 16, 15, 15, 8, 10, Arclite_Cannon_Edmund_Duke, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Edmund_Duke_Tank_Mode_Turret, 0, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 1, 1, 1, 1, 0, 10, Arclite_Cannon_Edmund_Duke, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Edmund_Duke_Siege_Mode, 400, 0, 3, 300, 200, 1500, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 10, Arclite_Shock_Cannon_Edmund_Duke, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Edmund_Duke_Siege_Mode_Turret, 0, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 1, 1, 1, 1, 12, 10, Arclite_Shock_Cannon_Edmund_Duke, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Arcturus_Mengsk, 1000, 0, 4, 800, 600, 4800, 0, 0, 255, 0, 2, 2, 37, 29, 37, 29, 0, 8, ATS_Laser_Battery_Hero, 1, ATA_Laser_Battery_Hero, 1)
+BWAPI_UNIT_TYPE(Hero_Hyperion, 850, 0, 4, 800, 600, 2400, 0, 0, 255, 0, 2, 2, 37, 29, 37, 29, 0, 11, ATS_Laser_Battery_Hyperion, 1, ATA_Laser_Battery_Hyperion, 1)
+BWAPI_UNIT_TYPE(Hero_Norad_II, 700, 0, 4, 800, 600, 4800, 0, 0, 255, 0, 2, 2, 37, 29, 37, 29, 0, 11, ATS_Laser_Battery_Hero, 1, ATA_Laser_Battery_Hero, 1)
+BWAPI_UNIT_TYPE(Terran_Siege_Tank_Siege_Mode, 150, 0, 1, 150, 100, 750, 4, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 10, Arclite_Shock_Cannon, 1, None, 0)
+BWAPI_UNIT_TYPE(Terran_Siege_Tank_Siege_Mode_Turret, 0, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 1, 1, 1, 1, 12, 10, Arclite_Shock_Cannon, 1, None, 0)
+BWAPI_UNIT_TYPE(Terran_Firebat, 50, 0, 1, 50, 25, 360, 2, 0, 1, 0, 1, 1, 11, 7, 11, 14, 3, 7, Flame_Thrower, 3, None, 0)
+BWAPI_UNIT_TYPE(Spell_Scanner_Sweep, 0, 0, 0, 0, 0, 1, 0, 0, 255, 0, 1, 1, 13, 13, 13, 17, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Medic, 60, 0, 1, 50, 25, 450, 2, 0, 1, 0, 1, 1, 8, 9, 8, 10, 9, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Larva, 25, 0, 10, 1, 1, 1, 0, 0, 255, 0, 1, 1, 8, 8, 7, 7, 0, 4, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Egg, 200, 0, 10, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 4, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Zergling, 35, 0, 0, 50, 0, 420, 1, 0, 1, 0, 1, 1, 8, 4, 7, 11, 3, 5, Claws, 1, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Hydralisk, 80, 0, 0, 75, 25, 420, 2, 0, 2, 0, 1, 1, 10, 10, 10, 12, 0, 6, Needle_Spines, 1, Needle_Spines, 1)
+BWAPI_UNIT_TYPE(Zerg_Ultralisk, 400, 0, 1, 200, 200, 900, 8, 0, 4, 0, 2, 2, 19, 16, 18, 15, 3, 7, Kaiser_Blades, 1, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Broodling, 30, 0, 0, 1, 1, 1, 0, 0, 1, 0, 1, 1, 9, 9, 9, 9, 3, 5, Toxic_Spores, 1, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Drone, 40, 0, 0, 50, 0, 300, 2, 0, 1, 0, 1, 1, 11, 11, 11, 11, 0, 7, Spines, 1, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Overlord, 200, 0, 0, 100, 0, 600, 0, 16, 255, 8, 2, 2, 25, 25, 24, 24, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Mutalisk, 120, 0, 0, 100, 100, 600, 4, 0, 255, 0, 2, 2, 22, 22, 21, 21, 3, 7, Glave_Wurm, 1, Glave_Wurm, 1)
+BWAPI_UNIT_TYPE(Zerg_Guardian, 150, 0, 2, 50, 100, 600, 4, 0, 255, 0, 2, 2, 22, 22, 21, 21, 0, 11, Acid_Spore, 1, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Queen, 120, 0, 0, 100, 100, 750, 4, 0, 255, 0, 2, 2, 24, 24, 23, 23, 8, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Defiler, 80, 0, 1, 50, 150, 750, 4, 0, 2, 0, 1, 1, 13, 12, 13, 12, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Scourge, 25, 0, 0, 25, 75, 450, 1, 0, 255, 0, 1, 1, 12, 12, 11, 11, 3, 5, None, 0, Suicide_Scourge, 1)
+BWAPI_UNIT_TYPE(Hero_Torrasque, 800, 0, 4, 400, 400, 1800, 0, 0, 4, 0, 2, 2, 19, 16, 18, 15, 3, 7, Kaiser_Blades_Torrasque, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Matriarch, 300, 0, 3, 200, 300, 1500, 0, 0, 255, 0, 2, 2, 24, 24, 23, 23, 8, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Infested_Terran, 60, 0, 0, 100, 50, 600, 2, 0, 1, 0, 1, 1, 8, 9, 8, 10, 3, 5, Suicide_Infested_Terran, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Infested_Kerrigan, 400, 0, 2, 200, 300, 1500, 0, 0, 1, 0, 1, 1, 7, 10, 7, 11, 3, 9, Claws_Infested_Kerrigan, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Unclean_One, 250, 0, 3, 50, 200, 1500, 0, 0, 2, 0, 1, 1, 13, 12, 13, 12, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Hero_Hunter_Killer, 160, 0, 2, 150, 50, 780, 0, 0, 2, 0, 1, 1, 10, 10, 10, 12, 0, 8, Needle_Spines_Hunter_Killer, 1, Needle_Spines_Hunter_Killer, 1)
+BWAPI_UNIT_TYPE(Hero_Devouring_One, 120, 0, 3, 100, 0, 840, 0, 0, 1, 0, 1, 1, 8, 4, 7, 11, 3, 5, Claws_Devouring_One, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Kukulza_Mutalisk, 300, 0, 3, 200, 200, 1200, 0, 0, 255, 0, 2, 2, 22, 22, 21, 21, 3, 7, Glave_Wurm_Kukulza, 1, Glave_Wurm_Kukulza, 1)
+BWAPI_UNIT_TYPE(Hero_Kukulza_Guardian, 400, 0, 4, 100, 200, 1200, 0, 0, 255, 0, 2, 2, 22, 22, 21, 21, 0, 11, Acid_Spore_Kukulza, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Yggdrasill, 1000, 0, 4, 200, 0, 1200, 0, 60, 255, 8, 2, 2, 25, 25, 24, 24, 0, 11, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Valkyrie, 200, 0, 2, 250, 125, 750, 6, 0, 255, 0, 2, 2, 24, 16, 24, 20, 0, 8, None, 0, Halo_Rockets, 4)
+BWAPI_UNIT_TYPE(Zerg_Cocoon, 200, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 4, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Corsair, 100, 80, 1, 150, 100, 600, 4, 0, 255, 0, 1, 1, 18, 16, 17, 15, 9, 9, None, 0, Neutron_Flare, 1)
+BWAPI_UNIT_TYPE(Protoss_Dark_Templar, 80, 40, 1, 125, 100, 750, 4, 0, 2, 0, 1, 1, 12, 6, 11, 19, 3, 7, Warp_Blades, 1, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Devourer, 250, 0, 2, 150, 50, 600, 4, 0, 255, 0, 2, 2, 22, 22, 21, 21, 7, 10, None, 0, Corrosive_Acid, 1)
+BWAPI_UNIT_TYPE(Protoss_Dark_Archon, 25, 200, 1, 0, 0, 300, 8, 0, 4, 0, 1, 1, 16, 16, 15, 15, 7, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Probe, 20, 20, 0, 50, 0, 300, 2, 0, 1, 0, 1, 1, 11, 11, 11, 11, 0, 8, Particle_Beam, 1, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Zealot, 100, 60, 1, 100, 0, 600, 4, 0, 2, 0, 1, 1, 11, 5, 11, 13, 3, 7, Psi_Blades, 2, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Dragoon, 100, 80, 1, 125, 50, 750, 4, 0, 4, 0, 1, 1, 15, 15, 16, 16, 0, 8, Phase_Disruptor, 1, Phase_Disruptor, 1)
+BWAPI_UNIT_TYPE(Protoss_High_Templar, 40, 40, 0, 50, 150, 750, 4, 0, 2, 0, 1, 1, 12, 10, 11, 13, 3, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Archon, 10, 350, 0, 0, 0, 300, 8, 0, 4, 0, 1, 1, 16, 16, 15, 15, 3, 8, Psionic_Shockwave, 1, Psionic_Shockwave, 1)
+BWAPI_UNIT_TYPE(Protoss_Shuttle, 80, 60, 1, 200, 0, 900, 4, 0, 255, 8, 2, 1, 20, 16, 19, 15, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Scout, 150, 100, 0, 275, 125, 1200, 6, 0, 255, 0, 2, 1, 18, 16, 17, 15, 0, 8, Dual_Photon_Blasters, 1, Anti_Matter_Missiles, 1)
+BWAPI_UNIT_TYPE(Protoss_Arbiter, 200, 150, 1, 100, 350, 2400, 8, 0, 255, 0, 2, 2, 22, 22, 21, 21, 0, 9, Phase_Disruptor_Cannon, 1, Phase_Disruptor_Cannon, 1)
+BWAPI_UNIT_TYPE(Protoss_Carrier, 300, 150, 4, 350, 250, 2100, 12, 0, 255, 0, 2, 2, 32, 32, 31, 31, 8, 11, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Interceptor, 40, 40, 0, 25, 0, 300, 0, 0, 255, 0, 1, 1, 8, 8, 7, 7, 0, 6, Pulse_Cannon, 1, Pulse_Cannon, 1)
+BWAPI_UNIT_TYPE(Hero_Dark_Templar, 40, 80, 0, 150, 150, 750, 2, 0, 2, 0, 1, 1, 12, 6, 11, 19, 3, 7, Warp_Blades_Hero, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Zeratul, 60, 400, 0, 100, 300, 1500, 0, 0, 2, 0, 1, 1, 12, 6, 11, 19, 3, 7, Warp_Blades_Zeratul, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Tassadar_Zeratul_Archon, 100, 800, 3, 0, 0, 600, 0, 0, 4, 0, 1, 1, 16, 16, 15, 15, 3, 8, Psionic_Shockwave_TZ_Archon, 1, Psionic_Shockwave_TZ_Archon, 1)
+BWAPI_UNIT_TYPE(Hero_Fenix_Zealot, 240, 240, 2, 200, 0, 1200, 0, 0, 2, 0, 1, 1, 11, 5, 11, 13, 3, 7, Psi_Blades_Fenix, 2, None, 0)
+BWAPI_UNIT_TYPE(Hero_Fenix_Dragoon, 240, 240, 3, 300, 100, 1500, 0, 0, 4, 0, 1, 1, 15, 15, 16, 16, 0, 8, Phase_Disruptor_Fenix, 1, Phase_Disruptor_Fenix, 1)
+BWAPI_UNIT_TYPE(Hero_Tassadar, 80, 300, 2, 100, 300, 1500, 0, 0, 2, 0, 1, 1, 12, 10, 11, 13, 3, 7, Psi_Assault, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Mojo, 400, 400, 3, 600, 300, 2400, 0, 0, 255, 0, 2, 1, 18, 16, 17, 15, 0, 10, Dual_Photon_Blasters_Mojo, 1, Anti_Matter_Missiles_Mojo, 1)
+BWAPI_UNIT_TYPE(Hero_Warbringer, 200, 400, 3, 400, 200, 1800, 0, 0, 4, 0, 1, 1, 16, 16, 15, 15, 8, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Hero_Gantrithor, 800, 500, 4, 700, 600, 4200, 0, 0, 255, 0, 2, 2, 32, 32, 31, 31, 8, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Reaver, 100, 80, 0, 200, 100, 1050, 8, 0, 4, 0, 1, 1, 16, 16, 15, 15, 8, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Observer, 40, 20, 0, 25, 75, 600, 2, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Scarab, 20, 10, 0, 15, 0, 105, 0, 0, 255, 0, 1, 1, 2, 2, 2, 2, 3, 5, Scarab, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Danimoth, 600, 500, 3, 50, 1000, 4800, 0, 0, 255, 0, 2, 2, 22, 22, 21, 21, 0, 9, Phase_Disruptor_Cannon_Danimoth, 1, Phase_Disruptor_Cannon_Danimoth, 1)
+BWAPI_UNIT_TYPE(Hero_Aldaris, 80, 300, 2, 100, 300, 1500, 0, 0, 2, 0, 1, 1, 12, 10, 11, 13, 3, 7, Psi_Assault, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Artanis, 250, 250, 3, 600, 300, 2400, 0, 0, 255, 0, 2, 1, 18, 16, 17, 15, 0, 10, Dual_Photon_Blasters_Artanis, 1, Anti_Matter_Missiles_Artanis, 1)
+BWAPI_UNIT_TYPE(Critter_Rhynadon, 60, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Critter_Bengalaas, 60, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Cargo_Ship, 125, 0, 1, 100, 100, 600, 0, 0, 255, 0, 1, 1, 15, 15, 16, 16, 8, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Mercenary_Gunship, 125, 0, 1, 100, 100, 600, 0, 0, 255, 0, 1, 1, 15, 15, 16, 16, 4, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Critter_Scantid, 60, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Critter_Kakaru, 60, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Critter_Ragnasaur, 60, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Critter_Ursadon, 60, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Lurker_Egg, 200, 0, 10, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 4, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Hero_Raszagal, 100, 60, 0, 150, 100, 750, 0, 0, 255, 0, 1, 1, 18, 16, 17, 15, 9, 9, None, 0, Neutron_Flare, 1)
+BWAPI_UNIT_TYPE(Hero_Samir_Duran, 200, 0, 2, 200, 75, 1500, 0, 0, 1, 0, 1, 1, 7, 10, 7, 11, 0, 10, C_10_Canister_Rifle_Samir_Duran, 1, C_10_Canister_Rifle_Samir_Duran, 1)
+BWAPI_UNIT_TYPE(Hero_Alexei_Stukov, 250, 0, 3, 200, 75, 1500, 0, 0, 1, 0, 1, 1, 7, 10, 7, 11, 0, 11, C_10_Canister_Rifle_Alexei_Stukov, 1, C_10_Canister_Rifle_Alexei_Stukov, 1)
+BWAPI_UNIT_TYPE(Special_Map_Revealer, 1, 0, 0, 0, 0, 1, 0, 0, 255, 0, 1, 1, 13, 13, 13, 17, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Hero_Gerard_DuGalle, 700, 0, 4, 800, 600, 4800, 0, 0, 255, 0, 2, 2, 37, 29, 37, 29, 0, 11, ATS_Laser_Battery_Hero, 1, ATA_Laser_Battery_Hero, 1)
+BWAPI_UNIT_TYPE(Zerg_Lurker, 125, 0, 1, 50, 100, 600, 4, 0, 4, 0, 1, 1, 15, 15, 16, 16, 6, 8, Subterranean_Spines, 1, None, 0)
+BWAPI_UNIT_TYPE(Hero_Infested_Duran, 300, 0, 3, 200, 75, 1500, 0, 0, 1, 0, 1, 1, 7, 10, 7, 11, 0, 11, C_10_Canister_Rifle_Infested_Duran, 1, C_10_Canister_Rifle_Infested_Duran, 1)
+BWAPI_UNIT_TYPE(Spell_Disruption_Web, 800, 0, 0, 250, 250, 2400, 0, 0, 255, 0, 4, 3, 60, 40, 59, 39, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Command_Center, 1500, 0, 1, 400, 0, 1800, 0, 20, 255, 0, 4, 3, 58, 41, 58, 41, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Comsat_Station, 500, 0, 1, 50, 50, 600, 0, 0, 255, 0, 2, 2, 37, 16, 31, 25, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Nuclear_Silo, 600, 0, 1, 100, 100, 1200, 0, 0, 255, 0, 2, 2, 37, 16, 31, 25, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Supply_Depot, 500, 0, 1, 100, 0, 600, 0, 16, 255, 0, 3, 2, 38, 22, 38, 26, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Refinery, 750, 0, 1, 100, 0, 600, 0, 0, 255, 0, 4, 2, 56, 32, 56, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Barracks, 1000, 0, 1, 150, 0, 1200, 0, 0, 255, 0, 4, 3, 48, 40, 56, 32, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Academy, 600, 0, 1, 150, 0, 1200, 0, 0, 255, 0, 3, 2, 40, 32, 44, 24, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Factory, 1250, 0, 1, 200, 100, 1200, 0, 0, 255, 0, 4, 3, 56, 40, 56, 40, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Starport, 1300, 0, 1, 150, 100, 1050, 0, 0, 255, 0, 4, 3, 48, 40, 48, 38, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Control_Tower, 500, 0, 1, 50, 50, 600, 0, 0, 255, 0, 2, 2, 47, 24, 28, 22, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Science_Facility, 850, 0, 1, 100, 150, 900, 0, 0, 255, 0, 4, 3, 48, 38, 48, 38, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Covert_Ops, 750, 0, 1, 50, 50, 600, 0, 0, 255, 0, 2, 2, 47, 24, 28, 22, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Physics_Lab, 600, 0, 1, 50, 50, 600, 0, 0, 255, 0, 2, 2, 47, 24, 28, 22, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Terran1, 0, 0, 1, 1, 1, 1, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Machine_Shop, 750, 0, 1, 50, 50, 600, 0, 0, 255, 0, 2, 2, 39, 24, 31, 24, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Terran2, 0, 0, 1, 1, 1, 1, 0, 0, 255, 0, 3, 3, 48, 48, 47, 47, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Engineering_Bay, 850, 0, 1, 125, 0, 900, 0, 0, 255, 0, 4, 3, 48, 32, 48, 28, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Armory, 750, 0, 1, 100, 50, 1200, 0, 0, 255, 0, 3, 2, 48, 32, 47, 22, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Terran_Missile_Turret, 200, 0, 0, 75, 0, 450, 0, 0, 255, 0, 2, 2, 16, 32, 16, 16, 0, 11, None, 0, Longbolt_Missile, 1)
+BWAPI_UNIT_TYPE(Terran_Bunker, 350, 0, 1, 100, 0, 450, 0, 0, 255, 4, 3, 2, 32, 24, 32, 16, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Crashed_Norad_II, 700, 0, 1, 800, 600, 4800, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Ion_Cannon, 2000, 0, 1, 200, 0, 900, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Uraj_Crystal, 10000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Khalis_Crystal, 10000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Infested_Command_Center, 1500, 0, 1, 1, 1, 1800, 0, 0, 255, 0, 4, 3, 58, 41, 58, 41, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Hatchery, 1250, 0, 1, 300, 0, 1800, 0, 2, 255, 0, 4, 3, 49, 32, 49, 32, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Lair, 1800, 0, 1, 150, 100, 1500, 0, 2, 255, 0, 4, 3, 49, 32, 49, 32, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Hive, 2500, 0, 1, 200, 150, 1800, 0, 2, 255, 0, 4, 3, 49, 32, 49, 32, 0, 11, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Nydus_Canal, 250, 0, 1, 150, 0, 600, 0, 0, 255, 0, 2, 2, 32, 32, 31, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Hydralisk_Den, 850, 0, 1, 100, 50, 600, 0, 0, 255, 0, 3, 2, 40, 32, 40, 24, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Defiler_Mound, 850, 0, 1, 100, 100, 900, 0, 0, 255, 0, 4, 2, 48, 32, 48, 4, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Greater_Spire, 1000, 0, 1, 100, 150, 1800, 0, 0, 255, 0, 2, 2, 28, 32, 28, 24, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Queens_Nest, 850, 0, 1, 150, 100, 900, 0, 0, 255, 0, 3, 2, 38, 28, 32, 28, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Evolution_Chamber, 750, 0, 1, 75, 0, 600, 0, 0, 255, 0, 3, 2, 44, 32, 32, 20, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Ultralisk_Cavern, 600, 0, 1, 150, 200, 1200, 0, 0, 255, 0, 3, 2, 40, 32, 32, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Spire, 600, 0, 1, 200, 150, 1800, 0, 0, 255, 0, 2, 2, 28, 32, 28, 24, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Spawning_Pool, 750, 0, 1, 200, 0, 1200, 0, 0, 255, 0, 3, 2, 36, 28, 40, 18, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Creep_Colony, 400, 0, 0, 75, 0, 300, 0, 0, 255, 0, 2, 2, 24, 24, 23, 23, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Spore_Colony, 400, 0, 0, 50, 0, 300, 0, 0, 255, 0, 2, 2, 24, 24, 23, 23, 0, 10, None, 0, Seeker_Spores, 1)
+BWAPI_UNIT_TYPE(Unused_Zerg1, 0, 0, 1, 1, 1, 1, 0, 0, 255, 0, 3, 3, 48, 48, 47, 47, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Sunken_Colony, 300, 0, 2, 50, 0, 300, 0, 0, 255, 0, 2, 2, 24, 24, 23, 23, 0, 10, Subterranean_Tentacle, 1, None, 0)
+BWAPI_UNIT_TYPE(Special_Overmind_With_Shell, 5000, 0, 1, 1, 1, 1, 0, 0, 255, 0, 5, 3, 80, 32, 79, 40, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Overmind, 2500, 0, 1, 1, 1, 1, 0, 0, 255, 0, 5, 3, 80, 32, 79, 40, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Zerg_Extractor, 750, 0, 1, 50, 0, 600, 0, 0, 255, 0, 4, 2, 64, 32, 63, 31, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Mature_Chrysalis, 250, 0, 1, 0, 0, 0, 0, 0, 255, 0, 2, 2, 32, 32, 31, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Cerebrate, 1500, 0, 1, 0, 0, 0, 0, 0, 255, 0, 3, 2, 40, 32, 32, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Cerebrate_Daggoth, 1500, 0, 1, 0, 0, 0, 0, 0, 255, 0, 3, 2, 40, 32, 32, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Zerg2, 0, 0, 1, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Nexus, 750, 750, 1, 400, 0, 1800, 0, 18, 255, 0, 4, 3, 56, 39, 56, 39, 0, 11, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Robotics_Facility, 500, 500, 1, 200, 200, 1200, 0, 0, 255, 0, 3, 2, 36, 16, 40, 20, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Pylon, 300, 300, 0, 100, 0, 450, 0, 16, 255, 0, 2, 2, 16, 12, 16, 20, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Assimilator, 450, 450, 1, 100, 0, 600, 0, 0, 255, 0, 4, 2, 48, 32, 48, 24, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Protoss1, 300, 300, 1, 1, 1, 1, 0, 0, 255, 0, 4, 3, 64, 48, 63, 47, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Observatory, 250, 250, 1, 50, 100, 450, 0, 0, 255, 0, 3, 2, 44, 16, 44, 28, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Gateway, 500, 500, 1, 150, 0, 900, 0, 0, 255, 0, 4, 3, 48, 32, 48, 40, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Protoss2, 0, 1, 1, 1, 1, 1, 0, 0, 255, 0, 3, 3, 48, 48, 47, 47, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Photon_Cannon, 100, 100, 0, 150, 0, 750, 0, 0, 255, 0, 2, 2, 20, 16, 20, 16, 0, 11, STS_Photon_Cannon, 1, STA_Photon_Cannon, 1)
+BWAPI_UNIT_TYPE(Protoss_Citadel_of_Adun, 450, 450, 1, 150, 100, 900, 0, 0, 255, 0, 3, 2, 24, 24, 40, 24, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Cybernetics_Core, 500, 500, 1, 200, 0, 900, 0, 0, 255, 0, 3, 2, 40, 24, 40, 24, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Templar_Archives, 500, 500, 1, 150, 200, 900, 0, 0, 255, 0, 3, 2, 32, 24, 32, 24, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Forge, 550, 550, 1, 150, 0, 600, 0, 0, 255, 0, 3, 2, 36, 24, 36, 20, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Stargate, 600, 600, 1, 150, 150, 1050, 0, 0, 255, 0, 4, 3, 48, 40, 48, 32, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Stasis_Cell_Prison, 2000, 0, 1, 150, 0, 1, 0, 0, 255, 0, 4, 3, 64, 48, 63, 47, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Fleet_Beacon, 500, 500, 1, 300, 200, 900, 0, 0, 255, 0, 3, 2, 40, 32, 47, 24, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Arbiter_Tribunal, 500, 500, 1, 200, 150, 900, 0, 0, 255, 0, 3, 2, 44, 28, 44, 28, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Robotics_Support_Bay, 450, 450, 1, 150, 100, 450, 0, 0, 255, 0, 3, 2, 32, 32, 32, 20, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Protoss_Shield_Battery, 200, 200, 1, 100, 0, 450, 0, 0, 255, 0, 3, 2, 32, 16, 32, 16, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Khaydarin_Crystal_Form, 100000, 0, 1, 250, 0, 1, 0, 0, 255, 0, 4, 3, 64, 48, 63, 47, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Protoss_Temple, 1500, 0, 1, 250, 0, 1, 0, 0, 255, 0, 7, 3, 112, 48, 111, 47, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_XelNaga_Temple, 5000, 0, 1, 1500, 500, 4800, 0, 0, 255, 0, 5, 4, 80, 34, 79, 63, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Resource_Mineral_Field, 100000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 2, 1, 32, 16, 31, 15, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Resource_Mineral_Field_Type_2, 100000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 2, 1, 32, 16, 31, 15, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Resource_Mineral_Field_Type_3, 100000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 2, 1, 32, 16, 31, 15, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Cave, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 2, 2, 32, 32, 31, 31, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Cave_In, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 2, 2, 32, 32, 31, 31, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Cantina, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 2, 2, 32, 32, 31, 31, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Mining_Platform, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 9, Platform_Laser_Battery, 1, None, 0)
+BWAPI_UNIT_TYPE(Unused_Independant_Command_Center, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Independant_Starport, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 2, 2, 32, 32, 31, 31, 0, 9, Independant_Laser_Battery, 1, None, 0)
+BWAPI_UNIT_TYPE(Unused_Independant_Jump_Gate, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Ruins, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Khaydarin_Crystal_Formation, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Resource_Vespene_Geyser, 100000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 4, 2, 64, 32, 63, 31, 0, 9, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Warp_Gate, 700, 0, 1, 600, 200, 2400, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Psi_Disrupter, 2000, 0, 1, 1000, 400, 4800, 0, 0, 255, 0, 5, 3, 80, 38, 69, 47, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Zerg_Marker, 100000, 0, 0, 250, 0, 1, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Terran_Marker, 100000, 0, 0, 50, 50, 1, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unused_Protoss_Marker, 100000, 0, 0, 100, 100, 1, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Zerg_Beacon, 100000, 0, 0, 250, 0, 1, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Terran_Beacon, 100000, 0, 0, 50, 50, 1, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Protoss_Beacon, 100000, 0, 0, 100, 100, 1, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Zerg_Flag_Beacon, 100000, 0, 0, 250, 0, 1, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Terran_Flag_Beacon, 100000, 0, 0, 50, 50, 1, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Protoss_Flag_Beacon, 100000, 0, 0, 100, 100, 1, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Power_Generator, 800, 0, 1, 200, 50, 2400, 0, 0, 255, 0, 4, 3, 56, 28, 63, 43, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Overmind_Cocoon, 2500, 0, 1, 1000, 500, 2400, 0, 0, 255, 0, 3, 2, 48, 32, 47, 31, 0, 10, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Spell_Dark_Swarm, 800, 0, 0, 250, 200, 2400, 0, 0, 255, 0, 5, 5, 80, 80, 79, 79, 0, 8, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Floor_Missile_Trap, 50, 0, 0, 1, 1, 1, 0, 0, 255, 0, 2, 2, 32, 32, 31, 31, 5, 6, Hellfire_Missile_Pack_Floor_Trap, 1, None, 0)
+BWAPI_UNIT_TYPE(Special_Floor_Hatch, 100000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 8, 4, 128, 64, 127, 63, 0, 7, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Upper_Level_Door, 100000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 3, 2, 25, 17, 44, 20, 0, 1, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Right_Upper_Level_Door, 100000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 3, 2, 44, 17, 25, 20, 0, 1, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Pit_Door, 100000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 3, 2, 41, 17, 28, 20, 0, 1, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Right_Pit_Door, 100000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 3, 2, 28, 17, 41, 20, 0, 1, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Special_Floor_Gun_Trap, 50, 0, 0, 1, 1, 1, 0, 0, 255, 0, 2, 2, 32, 32, 31, 31, 5, 6, Twin_Autocannons_Floor_Trap, 1, None, 0)
+BWAPI_UNIT_TYPE(Special_Wall_Missile_Trap, 50, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 5, 6, Hellfire_Missile_Pack_Wall_Trap, 1, None, 0)
+BWAPI_UNIT_TYPE(Special_Wall_Flame_Trap, 50, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 2, 3, Flame_Thrower_Wall_Trap, 1, None, 0)
+BWAPI_UNIT_TYPE(Special_Right_Wall_Missile_Trap, 50, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 5, 6, Hellfire_Missile_Pack_Wall_Trap, 1, None, 0)
+BWAPI_UNIT_TYPE(Special_Right_Wall_Flame_Trap, 50, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 2, 3, Flame_Thrower_Wall_Trap, 1, None, 0)
+BWAPI_UNIT_TYPE(Special_Start_Location, 800, 0, 0, 0, 0, 0, 0, 0, 255, 0, 4, 3, 48, 32, 48, 32, 0, 1, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Flag, 100000, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Young_Chrysalis, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Psi_Emitter, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Data_Disk, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Khaydarin_Crystal, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Mineral_Cluster_Type_1, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Mineral_Cluster_Type_2, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Protoss_Gas_Orb_Type_1, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Protoss_Gas_Orb_Type_2, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Zerg_Gas_Sac_Type_1, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Zerg_Gas_Sac_Type_2, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Terran_Gas_Tank_Type_1, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Powerup_Terran_Gas_Tank_Type_2, 800, 0, 0, 1, 1, 1, 0, 0, 255, 0, 1, 1, 16, 16, 15, 15, 0, 5, None, 0, None, 0)
+BWAPI_UNIT_TYPE(None, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, None, 0, None, 0)
+BWAPI_UNIT_TYPE(AllUnits, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Men, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Buildings, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Factories, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, None, 0, None, 0)
+BWAPI_UNIT_TYPE(Unknown, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, Unknown, 0, Unknown, 0)
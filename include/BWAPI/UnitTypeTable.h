@@ -0,0 +1,92 @@
+#pragma once
+#include <BWAPI/UnitType.h>
+
+#ifdef _MSC_VER
+#define BWAPI_CACHE_ALIGNED __declspec(align(64))
+#else
+#define BWAPI_CACHE_ALIGNED __attribute__((aligned(64)))
+#endif
+
+namespace BWAPI
+{
+  /// <summary>Bits of UnitTypeTable::flags, one per boolean unit type property.</summary>
+  namespace UnitTypeFlags
+  {
+    enum Enum : unsigned int
+    {
+      Building                = 0x00000001,
+      Addon                   = 0x00000002,
+      Flyer                   = 0x00000004,
+      Worker                  = 0x00000008,
+      Subunit                 = 0x00000010,
+      FlyingBuilding          = 0x00000020,
+      Hero                    = 0x00000040,
+      RegeneratesHP           = 0x00000080,
+      AnimatedIdle            = 0x00000100,
+      Cloakable               = 0x00000200,
+      TwoUnitsIn1Egg          = 0x00000400,
+      NeutralAccessories      = 0x00000800,
+      ResourceDepot           = 0x00001000,
+      ResourceContainer       = 0x00002000,
+      RoboticUnit             = 0x00004000,
+      Detector                = 0x00008000,
+      OrganicUnit             = 0x00010000,
+      CreepBuilding           = 0x00020000,
+      Unused                  = 0x00040000,
+      RequiresPsi             = 0x00080000,
+      Burrowable              = 0x00100000,
+      Spellcaster             = 0x00200000,
+      PermanentCloak          = 0x00400000,
+      NPCOrAccessories        = 0x00800000,
+      MorphFromOtherUnit      = 0x01000000,
+      LargeUnit               = 0x02000000,
+      HugeUnit                = 0x04000000,
+      AutoAttackAndMove       = 0x08000000,
+      Attack                  = 0x10000000, /**< Can attack */
+      Invincible              = 0x20000000,
+      Mechanical              = 0x40000000,
+      ProducesUnits           = 0x80000000 /**< It can produce units directly (making buildings doesn't count) */
+    };
+  }
+
+  /// <summary>The static properties of every unit type, one array per property, each indexed
+  /// by UnitType::getID().</summary>
+  /// UnitType's accessors read from this table. It is exposed so that code filtering many
+  /// units at once can test several properties with one masked load per unit, instead of a
+  /// function call per property.
+  ///
+  /// @code
+  ///   const unsigned wanted = UnitTypeFlags::Building | UnitTypeFlags::ResourceDepot;
+  ///   for ( int i = 0; i < count; ++i )
+  ///     isDepot[i] = (unitTypeTable.flags[typeIds[i]] & wanted) == wanted;
+  /// @endcode
+  struct BWAPI_CACHE_ALIGNED UnitTypeTable
+  {
+    unsigned int   flags[UnitTypes::Enum::MAX];          ///< UnitTypeFlags bits
+    int            maxHitPoints[UnitTypes::Enum::MAX];
+    unsigned short maxShields[UnitTypes::Enum::MAX];
+    unsigned short mineralPrice[UnitTypes::Enum::MAX];
+    unsigned short gasPrice[UnitTypes::Enum::MAX];
+    unsigned short buildTime[UnitTypes::Enum::MAX];
+    short          dimensionLeft[UnitTypes::Enum::MAX];
+    short          dimensionUp[UnitTypes::Enum::MAX];
+    short          dimensionRight[UnitTypes::Enum::MAX];
+    short          dimensionDown[UnitTypes::Enum::MAX];
+    unsigned char  armor[UnitTypes::Enum::MAX];
+    unsigned char  supplyRequired[UnitTypes::Enum::MAX];
+    unsigned char  supplyProvided[UnitTypes::Enum::MAX];
+    unsigned char  spaceRequired[UnitTypes::Enum::MAX];
+    unsigned char  spaceProvided[UnitTypes::Enum::MAX];
+    unsigned char  tileWidth[UnitTypes::Enum::MAX];
+    unsigned char  tileHeight[UnitTypes::Enum::MAX];
+    unsigned char  seekRangeTiles[UnitTypes::Enum::MAX];
+    unsigned char  sightRangeTiles[UnitTypes::Enum::MAX];
+    unsigned char  groundWeapon[UnitTypes::Enum::MAX];   ///< WeaponType id
+    unsigned char  airWeapon[UnitTypes::Enum::MAX];      ///< WeaponType id
+    unsigned char  maxGroundHits[UnitTypes::Enum::MAX];
+    unsigned char  maxAirHits[UnitTypes::Enum::MAX];
+  };
+
+  /// <summary>The unit type property table.</summary>
+  extern const UnitTypeTable &unitTypeTable;
+}
@@ -0,0 +1,70 @@
+// Numeric properties of every upgrade type, one row per upgrade id including the unused ids.
+// This is the single source of these values: UpgradeTypeTraits (TypeTraits.h) and the
+// UpgradeType tables (UpgradeType.cpp) are both expanded from it. Prices and times are for
+// the first level; each further level adds the matching factor once. The gas price of an
+// upgrade is always the same as its mineral price.
+//
+// BWAPI_UPGRADE_TYPE(id, mineralPrice, mineralPriceFactor, upgradeTime, upgradeTimeFactor, maxRepeats)
+BWAPI_UPGRADE_TYPE(0, 100, 75, 4000, 480, 3) // Terran_Infantry_Armor
+BWAPI_UPGRADE_TYPE(1, 100, 75, 4000, 480, 3) // Terran_Vehicle_Plating
+BWAPI_UPGRADE_TYPE(2, 150, 75, 4000, 480, 3) // Terran_Ship_Plating
+BWAPI_UPGRADE_TYPE(3, 150, 75, 4000, 480, 3) // Zerg_Carapace
+BWAPI_UPGRADE_TYPE(4, 150, 75, 4000, 480, 3) // Zerg_Flyer_Carapace
+BWAPI_UPGRADE_TYPE(5, 100, 75, 4000, 480, 3) // Protoss_Ground_Armor
+BWAPI_UPGRADE_TYPE(6, 150, 75, 4000, 480, 3) // Protoss_Air_Armor
+BWAPI_UPGRADE_TYPE(7, 100, 75, 4000, 480, 3) // Terran_Infantry_Weapons
+BWAPI_UPGRADE_TYPE(8, 100, 75, 4000, 480, 3) // Terran_Vehicle_Weapons
+BWAPI_UPGRADE_TYPE(9, 100, 50, 4000, 480, 3) // Terran_Ship_Weapons
+BWAPI_UPGRADE_TYPE(10, 100, 50, 4000, 480, 3) // Zerg_Melee_Attacks
+BWAPI_UPGRADE_TYPE(11, 100, 50, 4000, 480, 3) // Zerg_Missile_Attacks
+BWAPI_UPGRADE_TYPE(12, 100, 75, 4000, 480, 3) // Zerg_Flyer_Attacks
+BWAPI_UPGRADE_TYPE(13, 100, 50, 4000, 480, 3) // Protoss_Ground_Weapons
+BWAPI_UPGRADE_TYPE(14, 100, 75, 4000, 480, 3) // Protoss_Air_Weapons
+BWAPI_UPGRADE_TYPE(15, 200, 100, 4000, 480, 3) // Protoss_Plasma_Shields
+BWAPI_UPGRADE_TYPE(16, 150, 0, 1500, 0, 1) // U_238_Shells
+BWAPI_UPGRADE_TYPE(17, 100, 0, 1500, 0, 1) // Ion_Thrusters
+BWAPI_UPGRADE_TYPE(18, 200, 0, 0, 0, 0)
+BWAPI_UPGRADE_TYPE(19, 150, 0, 2500, 0, 1) // Titan_Reactor
+BWAPI_UPGRADE_TYPE(20, 100, 0, 2500, 0, 1) // Ocular_Implants
+BWAPI_UPGRADE_TYPE(21, 150, 0, 2500, 0, 1) // Moebius_Reactor
+BWAPI_UPGRADE_TYPE(22, 200, 0, 2500, 0, 1) // Apollo_Reactor
+BWAPI_UPGRADE_TYPE(23, 150, 0, 2500, 0, 1) // Colossus_Reactor
+BWAPI_UPGRADE_TYPE(24, 200, 0, 2400, 0, 1) // Ventral_Sacs
+BWAPI_UPGRADE_TYPE(25, 150, 0, 2000, 0, 1) // Antennae
+BWAPI_UPGRADE_TYPE(26, 150, 0, 2000, 0, 1) // Pneumatized_Carapace
+BWAPI_UPGRADE_TYPE(27, 100, 0, 1500, 0, 1) // Metabolic_Boost
+BWAPI_UPGRADE_TYPE(28, 200, 0, 1500, 0, 1) // Adrenal_Glands
+BWAPI_UPGRADE_TYPE(29, 150, 0, 1500, 0, 1) // Muscular_Augments
+BWAPI_UPGRADE_TYPE(30, 150, 0, 1500, 0, 1) // Grooved_Spines
+BWAPI_UPGRADE_TYPE(31, 150, 0, 2500, 0, 1) // Gamete_Meiosis
+BWAPI_UPGRADE_TYPE(32, 150, 0, 2500, 0, 1) // Metasynaptic_Node
+BWAPI_UPGRADE_TYPE(33, 150, 0, 2500, 0, 1) // Singularity_Charge
+BWAPI_UPGRADE_TYPE(34, 150, 0, 2000, 0, 1) // Leg_Enhancements
+BWAPI_UPGRADE_TYPE(35, 200, 0, 2500, 0, 1) // Scarab_Damage
+BWAPI_UPGRADE_TYPE(36, 200, 0, 2500, 0, 1) // Reaver_Capacity
+BWAPI_UPGRADE_TYPE(37, 200, 0, 2500, 0, 1) // Gravitic_Drive
+BWAPI_UPGRADE_TYPE(38, 150, 0, 2000, 0, 1) // Sensor_Array
+BWAPI_UPGRADE_TYPE(39, 150, 0, 2000, 0, 1) // Gravitic_Boosters
+BWAPI_UPGRADE_TYPE(40, 150, 0, 2500, 0, 1) // Khaydarin_Amulet
+BWAPI_UPGRADE_TYPE(41, 100, 0, 2500, 0, 1) // Apial_Sensors
+BWAPI_UPGRADE_TYPE(42, 200, 0, 2500, 0, 1) // Gravitic_Thrusters
+BWAPI_UPGRADE_TYPE(43, 100, 0, 1500, 0, 1) // Carrier_Capacity
+BWAPI_UPGRADE_TYPE(44, 150, 0, 2500, 0, 1) // Khaydarin_Core
+BWAPI_UPGRADE_TYPE(45, 0, 0, 0, 0, 0)
+BWAPI_UPGRADE_TYPE(46, 0, 0, 0, 0, 0)
+BWAPI_UPGRADE_TYPE(47, 100, 0, 2500, 0, 1) // Argus_Jewel
+BWAPI_UPGRADE_TYPE(48, 100, 0, 2500, 0, 0)
+BWAPI_UPGRADE_TYPE(49, 150, 0, 2500, 0, 1) // Argus_Talisman
+BWAPI_UPGRADE_TYPE(50, 150, 0, 2500, 0, 0)
+BWAPI_UPGRADE_TYPE(51, 150, 0, 2500, 0, 1) // Caduceus_Reactor
+BWAPI_UPGRADE_TYPE(52, 150, 0, 2000, 0, 1) // Chitinous_Plating
+BWAPI_UPGRADE_TYPE(53, 200, 0, 2000, 0, 1) // Anabolic_Synthesis
+BWAPI_UPGRADE_TYPE(54, 100, 0, 2000, 0, 1) // Charon_Boosters
+BWAPI_UPGRADE_TYPE(55, 0, 0, 0, 0, 0)
+BWAPI_UPGRADE_TYPE(56, 0, 0, 0, 0, 0)
+BWAPI_UPGRADE_TYPE(57, 0, 0, 0, 0, 0)
+BWAPI_UPGRADE_TYPE(58, 0, 0, 0, 0, 0)
+BWAPI_UPGRADE_TYPE(59, 0, 0, 0, 0, 0)
+BWAPI_UPGRADE_TYPE(60, 0, 0, 0, 0, 0) // Upgrade_60
+BWAPI_UPGRADE_TYPE(61, 0, 0, 0, 0, 0) // None
+BWAPI_UPGRADE_TYPE(62, 0, 0, 0, 0, 0) // Unknown
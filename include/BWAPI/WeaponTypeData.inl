@@ -0,0 +1,138 @@
+// Numeric properties of every weapon type, one row per weapon id including the unused ids.
+// This is the single source of these values: WeaponTypeTraits (TypeTraits.h) and the
+// WeaponType tables (WeaponType.cpp) are both expanded from it.
+//
+// BWAPI_WEAPON_TYPE(id, damage, damageBonus, cooldown, damageFactor, minRange, maxRange,
+//                   innerSplashRadius, medianSplashRadius, outerSplashRadius)
+BWAPI_WEAPON_TYPE(0, 6, 1, 15, 1, 0, 128, 0, 0, 0) // Gauss_Rifle
+BWAPI_WEAPON_TYPE(1, 18, 1, 15, 1, 0, 160, 0, 0, 0) // Gauss_Rifle_Jim_Raynor
+BWAPI_WEAPON_TYPE(2, 10, 1, 22, 1, 0, 224, 0, 0, 0) // C_10_Canister_Rifle
+BWAPI_WEAPON_TYPE(3, 30, 1, 22, 1, 0, 192, 0, 0, 0) // C_10_Canister_Rifle_Sarah_Kerrigan
+BWAPI_WEAPON_TYPE(4, 20, 2, 30, 1, 0, 160, 0, 0, 0) // Fragmentation_Grenade
+BWAPI_WEAPON_TYPE(5, 30, 2, 22, 1, 0, 160, 0, 0, 0) // Fragmentation_Grenade_Jim_Raynor
+BWAPI_WEAPON_TYPE(6, 125, 0, 22, 1, 0, 10, 50, 75, 100) // Spider_Mines
+BWAPI_WEAPON_TYPE(7, 12, 1, 22, 1, 0, 192, 0, 0, 0) // Twin_Autocannons
+BWAPI_WEAPON_TYPE(8, 10, 2, 22, 2, 0, 160, 0, 0, 0) // Hellfire_Missile_Pack
+BWAPI_WEAPON_TYPE(9, 24, 1, 22, 1, 0, 160, 0, 0, 0) // Twin_Autocannons_Alan_Schezar
+BWAPI_WEAPON_TYPE(10, 20, 1, 22, 2, 0, 160, 0, 0, 0) // Hellfire_Missile_Pack_Alan_Schezar
+BWAPI_WEAPON_TYPE(11, 30, 3, 37, 1, 0, 224, 0, 0, 0) // Arclite_Cannon
+BWAPI_WEAPON_TYPE(12, 70, 3, 37, 1, 0, 224, 0, 0, 0) // Arclite_Cannon_Edmund_Duke
+BWAPI_WEAPON_TYPE(13, 5, 1, 15, 1, 0, 10, 0, 0, 0) // Fusion_Cutter
+BWAPI_WEAPON_TYPE(14, 0, 0, 15, 1, 0, 10, 0, 0, 0)
+BWAPI_WEAPON_TYPE(15, 20, 2, 22, 1, 0, 160, 0, 0, 0) // Gemini_Missiles
+BWAPI_WEAPON_TYPE(16, 8, 1, 30, 1, 0, 160, 0, 0, 0) // Burst_Lasers
+BWAPI_WEAPON_TYPE(17, 40, 2, 22, 1, 0, 160, 0, 0, 0) // Gemini_Missiles_Tom_Kazansky
+BWAPI_WEAPON_TYPE(18, 16, 1, 30, 1, 0, 160, 0, 0, 0) // Burst_Lasers_Tom_Kazansky
+BWAPI_WEAPON_TYPE(19, 25, 3, 30, 1, 0, 192, 0, 0, 0) // ATS_Laser_Battery
+BWAPI_WEAPON_TYPE(20, 25, 3, 30, 1, 0, 192, 0, 0, 0) // ATA_Laser_Battery
+BWAPI_WEAPON_TYPE(21, 50, 3, 30, 1, 0, 192, 0, 0, 0) // ATS_Laser_Battery_Hero
+BWAPI_WEAPON_TYPE(22, 50, 3, 30, 1, 0, 192, 0, 0, 0) // ATA_Laser_Battery_Hero
+BWAPI_WEAPON_TYPE(23, 30, 3, 22, 1, 0, 192, 0, 0, 0) // ATS_Laser_Battery_Hyperion
+BWAPI_WEAPON_TYPE(24, 30, 3, 22, 1, 0, 192, 0, 0, 0) // ATA_Laser_Battery_Hyperion
+BWAPI_WEAPON_TYPE(25, 8, 1, 22, 1, 0, 32, 15, 20, 25) // Flame_Thrower
+BWAPI_WEAPON_TYPE(26, 16, 1, 22, 1, 0, 32, 15, 20, 25) // Flame_Thrower_Gui_Montag
+BWAPI_WEAPON_TYPE(27, 70, 5, 75, 1, 64, 384, 10, 25, 40) // Arclite_Shock_Cannon
+BWAPI_WEAPON_TYPE(28, 150, 5, 75, 1, 64, 384, 10, 25, 40) // Arclite_Shock_Cannon_Edmund_Duke
+BWAPI_WEAPON_TYPE(29, 20, 0, 15, 1, 0, 224, 0, 0, 0) // Longbolt_Missile
+BWAPI_WEAPON_TYPE(30, 260, 0, 15, 1, 0, 320, 0, 0, 0) // Yamato_Gun
+BWAPI_WEAPON_TYPE(31, 600, 0, 1, 1, 0, 3, 128, 192, 256) // Nuclear_Strike
+BWAPI_WEAPON_TYPE(32, 0, 0, 1, 1, 0, 256, 0, 0, 0) // Lockdown
+BWAPI_WEAPON_TYPE(33, 0, 0, 1, 1, 0, 256, 64, 64, 64) // EMP_Shockwave
+BWAPI_WEAPON_TYPE(34, 250, 0, 75, 1, 0, 288, 0, 0, 0) // Irradiate
+BWAPI_WEAPON_TYPE(35, 5, 1, 8, 1, 0, 15, 0, 0, 0) // Claws
+BWAPI_WEAPON_TYPE(36, 10, 1, 8, 1, 0, 15, 0, 0, 0) // Claws_Devouring_One
+BWAPI_WEAPON_TYPE(37, 50, 1, 15, 1, 0, 15, 0, 0, 0) // Claws_Infested_Kerrigan
+BWAPI_WEAPON_TYPE(38, 10, 1, 15, 1, 0, 128, 0, 0, 0) // Needle_Spines
+BWAPI_WEAPON_TYPE(39, 20, 1, 15, 1, 0, 160, 0, 0, 0) // Needle_Spines_Hunter_Killer
+BWAPI_WEAPON_TYPE(40, 20, 3, 15, 1, 0, 25, 0, 0, 0) // Kaiser_Blades
+BWAPI_WEAPON_TYPE(41, 50, 3, 15, 1, 0, 25, 0, 0, 0) // Kaiser_Blades_Torrasque
+BWAPI_WEAPON_TYPE(42, 4, 1, 15, 1, 0, 2, 0, 0, 0) // Toxic_Spores
+BWAPI_WEAPON_TYPE(43, 5, 0, 22, 1, 0, 32, 0, 0, 0) // Spines
+BWAPI_WEAPON_TYPE(44, 0, 0, 22, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(45, 30, 1, 22, 1, 0, 64, 0, 0, 0)
+BWAPI_WEAPON_TYPE(46, 20, 2, 30, 1, 0, 256, 0, 0, 0) // Acid_Spore
+BWAPI_WEAPON_TYPE(47, 40, 2, 30, 1, 0, 256, 0, 0, 0) // Acid_Spore_Kukulza
+BWAPI_WEAPON_TYPE(48, 9, 1, 30, 1, 0, 96, 0, 0, 0) // Glave_Wurm
+BWAPI_WEAPON_TYPE(49, 18, 1, 30, 1, 0, 96, 0, 0, 0) // Glave_Wurm_Kukulza
+BWAPI_WEAPON_TYPE(50, 5, 1, 22, 1, 0, 128, 10, 20, 30)
+BWAPI_WEAPON_TYPE(51, 10, 1, 22, 1, 0, 128, 10, 20, 30)
+BWAPI_WEAPON_TYPE(52, 15, 0, 15, 1, 0, 224, 0, 0, 0) // Seeker_Spores
+BWAPI_WEAPON_TYPE(53, 40, 0, 32, 1, 0, 224, 0, 0, 0) // Subterranean_Tentacle
+BWAPI_WEAPON_TYPE(54, 500, 0, 1, 1, 0, 3, 20, 40, 60) // Suicide_Infested_Terran
+BWAPI_WEAPON_TYPE(55, 110, 0, 1, 1, 0, 3, 0, 0, 0) // Suicide_Scourge
+BWAPI_WEAPON_TYPE(56, 0, 0, 1, 1, 0, 384, 0, 0, 0) // Parasite
+BWAPI_WEAPON_TYPE(57, 0, 0, 1, 1, 0, 288, 0, 0, 0) // Spawn_Broodlings
+BWAPI_WEAPON_TYPE(58, 0, 0, 1, 1, 0, 288, 0, 0, 0) // Ensnare
+BWAPI_WEAPON_TYPE(59, 0, 0, 1, 1, 0, 288, 0, 0, 0) // Dark_Swarm
+BWAPI_WEAPON_TYPE(60, 300, 0, 1, 1, 0, 288, 0, 0, 0) // Plague
+BWAPI_WEAPON_TYPE(61, 0, 0, 1, 1, 0, 16, 0, 0, 0) // Consume
+BWAPI_WEAPON_TYPE(62, 5, 0, 22, 1, 0, 32, 0, 0, 0) // Particle_Beam
+BWAPI_WEAPON_TYPE(63, 0, 0, 22, 1, 0, 10, 0, 0, 0)
+BWAPI_WEAPON_TYPE(64, 8, 1, 22, 1, 0, 15, 0, 0, 0) // Psi_Blades
+BWAPI_WEAPON_TYPE(65, 20, 1, 22, 1, 0, 15, 0, 0, 0) // Psi_Blades_Fenix
+BWAPI_WEAPON_TYPE(66, 20, 2, 30, 1, 0, 128, 0, 0, 0) // Phase_Disruptor
+BWAPI_WEAPON_TYPE(67, 45, 2, 22, 1, 0, 128, 0, 0, 0) // Phase_Disruptor_Fenix
+BWAPI_WEAPON_TYPE(68, 5, 1, 30, 1, 0, 96, 0, 0, 0)
+BWAPI_WEAPON_TYPE(69, 20, 1, 22, 1, 0, 96, 0, 0, 0) // Psi_Assault
+BWAPI_WEAPON_TYPE(70, 30, 3, 20, 1, 0, 64, 3, 15, 30) // Psionic_Shockwave
+BWAPI_WEAPON_TYPE(71, 60, 3, 20, 1, 0, 64, 3, 15, 30) // Psionic_Shockwave_TZ_Archon
+BWAPI_WEAPON_TYPE(72, 4, 0, 22, 1, 0, 32, 0, 0, 0)
+BWAPI_WEAPON_TYPE(73, 8, 1, 30, 1, 0, 128, 0, 0, 0) // Dual_Photon_Blasters
+BWAPI_WEAPON_TYPE(74, 14, 1, 22, 2, 0, 128, 0, 0, 0) // Anti_Matter_Missiles
+BWAPI_WEAPON_TYPE(75, 20, 1, 30, 1, 0, 128, 0, 0, 0) // Dual_Photon_Blasters_Mojo
+BWAPI_WEAPON_TYPE(76, 28, 1, 22, 2, 0, 128, 0, 0, 0) // Anti_Matter_Missiles_Mojo
+BWAPI_WEAPON_TYPE(77, 10, 1, 45, 1, 0, 160, 0, 0, 0) // Phase_Disruptor_Cannon
+BWAPI_WEAPON_TYPE(78, 20, 1, 45, 1, 0, 160, 0, 0, 0) // Phase_Disruptor_Cannon_Danimoth
+BWAPI_WEAPON_TYPE(79, 6, 1, 1, 1, 0, 128, 0, 0, 0) // Pulse_Cannon
+BWAPI_WEAPON_TYPE(80, 20, 0, 22, 1, 0, 224, 0, 0, 0) // STS_Photon_Cannon
+BWAPI_WEAPON_TYPE(81, 20, 0, 22, 1, 0, 224, 0, 0, 0) // STA_Photon_Cannon
+BWAPI_WEAPON_TYPE(82, 100, 25, 1, 1, 0, 128, 20, 40, 60) // Scarab
+BWAPI_WEAPON_TYPE(83, 0, 1, 1, 1, 0, 288, 0, 0, 0) // Stasis_Field
+BWAPI_WEAPON_TYPE(84, 14, 1, 45, 1, 0, 288, 48, 48, 48) // Psionic_Storm
+BWAPI_WEAPON_TYPE(85, 100, 1, 22, 1, 0, 15, 0, 0, 0) // Warp_Blades_Zeratul
+BWAPI_WEAPON_TYPE(86, 45, 1, 30, 1, 0, 15, 0, 0, 0) // Warp_Blades_Hero
+BWAPI_WEAPON_TYPE(87, 7, 1, 22, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(88, 7, 1, 22, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(89, 7, 1, 22, 1, 0, 32, 0, 0, 0)
+BWAPI_WEAPON_TYPE(90, 7, 1, 22, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(91, 7, 1, 22, 1, 0, 224, 0, 0, 0)
+BWAPI_WEAPON_TYPE(92, 7, 1, 22, 1, 0, 224, 0, 0, 0) // Platform_Laser_Battery
+BWAPI_WEAPON_TYPE(93, 7, 1, 22, 1, 0, 128, 0, 0, 0) // Independant_Laser_Battery
+BWAPI_WEAPON_TYPE(94, 4, 1, 9, 1, 0, 160, 0, 0, 0)
+BWAPI_WEAPON_TYPE(95, 30, 1, 22, 1, 0, 192, 0, 0, 0)
+BWAPI_WEAPON_TYPE(96, 10, 1, 22, 1, 0, 160, 0, 0, 0) // Twin_Autocannons_Floor_Trap
+BWAPI_WEAPON_TYPE(97, 10, 1, 22, 2, 0, 160, 0, 0, 0) // Hellfire_Missile_Pack_Wall_Trap
+BWAPI_WEAPON_TYPE(98, 8, 1, 22, 1, 0, 64, 15, 20, 25) // Flame_Thrower_Wall_Trap
+BWAPI_WEAPON_TYPE(99, 10, 1, 22, 2, 0, 160, 0, 0, 0) // Hellfire_Missile_Pack_Floor_Trap
+BWAPI_WEAPON_TYPE(100, 5, 1, 8, 1, 0, 160, 5, 50, 100) // Neutron_Flare
+BWAPI_WEAPON_TYPE(101, 0, 0, 22, 1, 0, 288, 0, 0, 0) // Disruption_Web
+BWAPI_WEAPON_TYPE(102, 20, 0, 22, 1, 0, 192, 0, 0, 0) // Restoration
+BWAPI_WEAPON_TYPE(103, 6, 1, 64, 2, 0, 192, 5, 50, 100) // Halo_Rockets
+BWAPI_WEAPON_TYPE(104, 25, 2, 100, 1, 0, 192, 0, 0, 0) // Corrosive_Acid
+BWAPI_WEAPON_TYPE(105, 8, 1, 22, 1, 0, 256, 0, 0, 0) // Mind_Control
+BWAPI_WEAPON_TYPE(106, 8, 1, 22, 1, 0, 320, 0, 0, 0) // Feedback
+BWAPI_WEAPON_TYPE(107, 8, 1, 22, 1, 0, 288, 0, 0, 0) // Optical_Flare
+BWAPI_WEAPON_TYPE(108, 0, 1, 1, 1, 0, 320, 0, 0, 0) // Maelstrom
+BWAPI_WEAPON_TYPE(109, 20, 2, 37, 1, 0, 192, 20, 20, 20) // Subterranean_Spines
+BWAPI_WEAPON_TYPE(110, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(111, 40, 3, 30, 1, 0, 15, 0, 0, 0) // Warp_Blades
+BWAPI_WEAPON_TYPE(112, 25, 1, 22, 1, 0, 192, 0, 0, 0) // C_10_Canister_Rifle_Samir_Duran
+BWAPI_WEAPON_TYPE(113, 25, 1, 22, 1, 0, 192, 0, 0, 0) // C_10_Canister_Rifle_Infested_Duran
+BWAPI_WEAPON_TYPE(114, 20, 1, 30, 1, 0, 128, 0, 0, 0) // Dual_Photon_Blasters_Artanis
+BWAPI_WEAPON_TYPE(115, 28, 1, 22, 2, 0, 128, 0, 0, 0) // Anti_Matter_Missiles_Artanis
+BWAPI_WEAPON_TYPE(116, 30, 1, 22, 1, 0, 192, 0, 0, 0) // C_10_Canister_Rifle_Alexei_Stukov
+BWAPI_WEAPON_TYPE(117, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(118, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(119, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(120, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(121, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(122, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(123, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(124, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(125, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(126, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(127, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(128, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(129, 6, 1, 15, 1, 0, 128, 0, 0, 0)
+BWAPI_WEAPON_TYPE(130, 0, 0, 0, 0, 0, 0, 0, 0, 0) // None
+BWAPI_WEAPON_TYPE(131, 0, 0, 0, 0, 0, 0, 0, 0, 0) // Unknown